@@ -17,8 +17,8 @@ class testcontainersRecipe(ConanFile):
 
     # Binary configuration
     settings = "os", "compiler", "build_type", "arch"
-    options = {"shared": [True, False], "fPIC": [True, False]}
-    default_options = {"shared": True, "fPIC": True}
+    options = {"shared": [True, False], "fPIC": [True, False], "benchmarks": [True, False]}
+    default_options = {"shared": True, "fPIC": True, "benchmarks": False}
 
     # Sources are located in the same place as this recipe, copy them to the recipe
     exports_sources = "CMakeLists.txt", "cmake/*", "rust/*", "!rust/target/*", "cpp/*", "tests/*", "LICENSE-MIT.txt", "LICENSE-Apache-2.0"
@@ -31,18 +31,25 @@ class testcontainersRecipe(ConanFile):
         if self.options.shared:
             self.options.rm_safe("fPIC")
 
+    def package_id(self):
+        # Benchmarks are never packaged
+        del self.info.options.benchmarks
+
     def layout(self):
         cmake_layout(self)
 
     def build_requirements(self):
         if not self.conf.get("tools.build:skip_test", default=False):
             self.test_requires("gtest/1.14.0")
+            if self.options.benchmarks:
+                self.test_requires("benchmark/1.8.4")
     
     def generate(self):
         deps = CMakeDeps(self)
         deps.generate()
         tc = CMakeToolchain(self)
         tc.cache_variables["SKIP_CONAN_PROVIDER_CMAKE"] = True
+        tc.cache_variables["TESTCONTAINERS_BUILD_BENCHMARKS"] = bool(self.options.benchmarks)
         tc.generate()
 
     def build(self):
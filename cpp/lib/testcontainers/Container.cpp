@@ -4,6 +4,7 @@
 #include "testcontainers/Container.hpp"
 #include "testcontainers/core/ExecCommand.hpp"
 #include "testcontainers/core/SyncExecResult.hpp"
+#include "testcontainers/system/Path.hpp"
 #include "testcontainers/system/UrlHost.hpp"
 #include "details/OptionHelper.hpp"
 
@@ -23,6 +24,8 @@ Container::~Container() noexcept = default;
 
 bool Container::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
 
+std::string Container::id() const { return std::string(rimpl_->rs_container_id()); }
+
 std::uint16_t Container::get_host_port_ipv4(ContainerPort port) const {
   return details::call_map_error(&RsContainer::rs_container_get_host_port_ipv4, rimpl_.get(),
                                  details::into_box(port.rimpl_));
@@ -45,6 +48,33 @@ SyncExecResult Container::exec(ExecCommand cmd) const {
 
 void Container::stop() const { details::call_map_error(&RsContainer::rs_container_stop, rimpl_.get()); }
 
+void Container::copy_to(std::string_view target, CopyDataSource source) const {
+  details::call_map_error(&RsContainer::rs_container_copy_to, rimpl_.get(),
+                          details::into_str(target), details::into_box(source.rimpl_));
+}
+
+FileReader Container::copy_file_from(std::string_view path) const {
+  return FileReader(details::call_map_error(&RsContainer::rs_container_copy_file_from,
+                                            rimpl_.get(), details::into_str(path))
+                        .into_raw());
+}
+
+void Container::copy_to_host(std::string_view path,
+                             const std::filesystem::path &host_path) const {
+  Path path_obj(host_path);
+  details::call_map_error(&RsContainer::rs_container_copy_to_host, rimpl_.get(),
+                          details::into_str(path), details::into_box(path_obj.rimpl_));
+}
+
+Future<SyncExecResult> Container::exec_async(ExecCommand cmd) const {
+  return Future<SyncExecResult>(
+      rimpl_->rs_container_exec_async(details::into_box(cmd.rimpl_)).into_raw());
+}
+
+Future<void> Container::stop_async() const {
+  return Future<void>(rimpl_->rs_container_stop_async().into_raw());
+}
+
 void Container::stop_with_timeout(std::optional<std::int32_t> timeout_sec) const {
   details::call_map_error(&RsContainer::rs_container_stop_with_timeout, rimpl_.get(),
                            utils::optional_to_vec(std::move(timeout_sec)));
@@ -66,20 +96,49 @@ std::vector<std::uint8_t> Container::stderr_to_vec() const noexcept {
   return std::vector<std::uint8_t>(rust_vec.begin(), rust_vec.end());
 }
 
+LogStream Container::stdout_stream(bool follow) const noexcept {
+  return LogStream(rimpl_->rs_container_stdout(follow).into_raw());
+}
+
+LogStream Container::stderr_stream(bool follow) const noexcept {
+  return LogStream(rimpl_->rs_container_stderr(follow).into_raw());
+}
+
 bool Container::is_running() const noexcept { return rimpl_->rs_container_is_running(); }
 
 std::optional<std::int64_t> Container::exit_code() const noexcept {
   return utils::vec_to_optional(rimpl_->rs_container_exit_code_opt());
 }
 
-std::string Container::stdout_to_string() const {
-  const auto out = stdout_to_vec();
-  return std::string(out.begin(), out.end());
+Bytes Container::stdout_bytes() const {
+  return Bytes(details::call_map_error(&RsContainer::rs_container_stdout_bytes, rimpl_.get())
+                   .into_raw());
 }
 
-std::string Container::stderr_to_string() const {
-  const auto err = stderr_to_vec();
-  return std::string(err.begin(), err.end());
+Bytes Container::stderr_bytes() const {
+  return Bytes(details::call_map_error(&RsContainer::rs_container_stderr_bytes, rimpl_.get())
+                   .into_raw());
 }
 
+StartupProfile Container::startup_profile() const {
+  auto rs_profile =
+      details::call_map_error(&RsContainer::rs_container_startup_profile, rimpl_.get());
+
+  StartupProfile profile;
+  profile.pull = StartupProfile::Duration(rs_profile.pull_ns);
+  profile.create = StartupProfile::Duration(rs_profile.create_ns);
+  profile.start = StartupProfile::Duration(rs_profile.start_ns);
+  profile.total = StartupProfile::Duration(rs_profile.total_ns);
+  profile.conditions.reserve(rs_profile.conditions.size());
+  for (const auto &condition : rs_profile.conditions) {
+    profile.conditions.push_back(
+        {std::string(condition.description), StartupProfile::Duration(condition.duration_ns)});
+  }
+  return profile;
+}
+
+std::string Container::stdout_to_string() const { return stdout_bytes().to_string(); }
+
+std::string Container::stderr_to_string() const { return stderr_bytes().to_string(); }
+
 } // namespace testcontainers
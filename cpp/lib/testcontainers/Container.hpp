@@ -1,14 +1,22 @@
 #pragma once
 
 #include <cstdint>
+#include <filesystem>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "testcontainers/Future.hpp"
+#include "testcontainers/StartupProfile.hpp"
 #include "testcontainers/core/ContainerPort.hpp"
+#include "testcontainers/core/CopyDataSource.hpp"
+#include "testcontainers/core/FileReader.hpp"
+#include "testcontainers/core/LogStream.hpp"
 #include "testcontainers/interfaces/IContainer.hpp"
 #include "testcontainers/interfaces/IRustObject.hpp"
+#include "testcontainers/system/Bytes.hpp"
 
 class RsContainer;
 
@@ -43,6 +51,7 @@ public: // IRustObject interface
   bool is_valid() const noexcept override;
 
 public: // IContainer interface
+  std::string id() const override;
   std::uint16_t get_host_port_ipv4(ContainerPort port) const override;
   std::uint16_t get_host_port_ipv6(ContainerPort port) const override;
   UrlHost get_host() const override;
@@ -52,18 +61,65 @@ public: // IContainer interface
   void start() const override;
   std::vector<std::uint8_t> stdout_to_vec() const noexcept override;
   std::vector<std::uint8_t> stderr_to_vec() const noexcept override;
+  LogStream stdout_stream(bool follow = true) const noexcept override;
+  LogStream stderr_stream(bool follow = true) const noexcept override;
   bool is_running() const noexcept override;
   std::optional<std::int64_t> exit_code() const noexcept override;
 
   static void rm(Container container);
 
+  /**
+   * @brief Copy a file or buffer into the running container.
+   *
+   * The data is streamed to the Docker archive endpoint; File and MappedFile sources are
+   * memory-mapped rather than read into memory.
+   */
+  void copy_to(std::string_view target, CopyDataSource source) const;
+
+  /**
+   * @brief Open a regular file inside the container for chunked reading.
+   *
+   * @throws Error if the path does not exist or is not a regular file.
+   */
+  FileReader copy_file_from(std::string_view path) const;
+
+  /**
+   * @brief Copy a regular file out of the container straight to host_path.
+   *
+   * The file is written to disk as it arrives and never crosses into C++ memory.
+   */
+  void copy_to_host(std::string_view path, const std::filesystem::path &host_path) const;
+
+  /**
+   * @brief Time spent pulling, creating, starting and waiting for this container.
+   *
+   * Computed on each call from timings recorded by start() and one inspect of the container.
+   *
+   * @throws Error if the container was not started by start() or start_async() of this process.
+   */
+  StartupProfile startup_profile() const;
+
+public: // Async methods
+  /**
+   * @brief Run a command without blocking the caller.
+   *
+   * The operation keeps the container alive, rm() fails while it is pending.
+   */
+  Future<SyncExecResult> exec_async(ExecCommand cmd) const;
+  Future<void> stop_async() const;
+
 public: // Helper methods
+  /// Log history without the copy into a std::vector, valid as long as the returned Bytes.
+  Bytes stdout_bytes() const;
+  Bytes stderr_bytes() const;
   std::string stdout_to_string() const;
   std::string stderr_to_string() const;
 
 private:
   friend class GenericImage;
   friend class ContainerRequest;
+  friend class ContainerGroup;
+  template <typename T> friend class Future;
 
   explicit Container(RsContainer *container) noexcept;
 
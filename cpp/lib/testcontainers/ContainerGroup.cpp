@@ -0,0 +1,71 @@
+#include <rust/cxx.h>
+#include <rust_tc_bridge/lib.h>
+
+#include <iterator>
+#include <utility>
+
+#include "testcontainers/ContainerGroup.hpp"
+#include "details/OptionHelper.hpp"
+
+#include "details/BoxHelper.hpp"
+#include "details/ErrorHelper.hpp"
+
+namespace testcontainers {
+
+ContainerGroup::ContainerGroup(ContainerGroupOptions options) : options_(std::move(options)) {}
+
+ContainerGroup::ContainerGroup(std::vector<Container> containers, ContainerGroupOptions options)
+    : options_(std::move(options)), containers_(std::make_move_iterator(containers.begin()),
+                                                std::make_move_iterator(containers.end())) {}
+
+ContainerGroup::ContainerGroup(ContainerGroup &&other) noexcept = default;
+
+ContainerGroup &ContainerGroup::operator=(ContainerGroup &&other) noexcept {
+  if (this != &other) {
+    ContainerGroup closing(std::move(*this));
+    options_ = std::move(other.options_);
+    containers_ = std::move(other.containers_);
+    other.containers_.clear();
+  }
+  return *this;
+}
+
+ContainerGroup::~ContainerGroup() noexcept {
+  try {
+    teardown();
+  } catch (...) {
+    // Removal failures must not escape the destructor
+  }
+}
+
+const Container &ContainerGroup::add(Container container) {
+  return containers_.emplace_back(std::move(container));
+}
+
+void ContainerGroup::teardown() {
+  if (containers_.empty()) {
+    return;
+  }
+
+  rust::Vec<RsContainer> rust_containers;
+  rust_containers.reserve(containers_.size());
+  for (auto &container : containers_) {
+    if (container.is_valid()) {
+      ::rs_container_vec_push(rust_containers, details::into_box(container.rimpl_));
+    }
+  }
+  containers_.clear();
+
+  auto stop_timeout_sec = options_.stop_timeout_sec;
+  details::call_map_error(::rs_container_teardown_all, std::move(rust_containers),
+                          utils::optional_to_vec(std::move(stop_timeout_sec)));
+}
+
+std::vector<Container> ContainerGroup::release() noexcept {
+  std::vector<Container> containers(std::make_move_iterator(containers_.begin()),
+                                    std::make_move_iterator(containers_.end()));
+  containers_.clear();
+  return containers;
+}
+
+} // namespace testcontainers
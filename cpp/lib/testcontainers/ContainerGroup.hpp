@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <vector>
+
+#include "testcontainers/Container.hpp"
+
+namespace testcontainers {
+
+struct ContainerGroupOptions {
+  /// Seconds each member gets to stop before it is killed, the daemon default when unset.
+  std::optional<std::int32_t> stop_timeout_sec;
+};
+
+/**
+ * @brief Owns containers that are torn down together.
+ *
+ * Dropping containers one by one stops and removes them one after the other. A group stops
+ * and removes all of its members concurrently when it is destroyed or torn down, so the
+ * teardown of a fixture takes about as long as its slowest container.
+ *
+ * Example:
+ * @code
+ * {
+ *     ContainerGroup group(ContainerRequest::start_all(std::move(requests)),
+ *                          {.stop_timeout_sec = 1});
+ *     const auto &redis = group.add(GenericImage("redis", "7").start());
+ *     // Use containers...
+ * } // All members stopped and removed at once here
+ * @endcode
+ */
+class ContainerGroup final {
+public:
+  explicit ContainerGroup(ContainerGroupOptions options = {});
+  ContainerGroup(std::vector<Container> containers, ContainerGroupOptions options);
+  ContainerGroup(ContainerGroup &&other) noexcept;
+  ContainerGroup &operator=(ContainerGroup &&other) noexcept;
+
+  /// Tears the members down, failures are ignored.
+  ~ContainerGroup() noexcept;
+  ContainerGroup(const ContainerGroup &) = delete;
+  ContainerGroup &operator=(const ContainerGroup &) = delete;
+
+  /// Take ownership of container. The returned reference stays valid until teardown.
+  const Container &add(Container container);
+
+  std::size_t size() const noexcept { return containers_.size(); }
+  bool empty() const noexcept { return containers_.empty(); }
+  const Container &operator[](std::size_t index) const { return containers_.at(index); }
+
+  auto begin() const noexcept { return containers_.cbegin(); }
+  auto end() const noexcept { return containers_.cend(); }
+
+  /**
+   * @brief Stop and remove all members concurrently, leaving the group empty.
+   *
+   * Members used by pending async operations are stopped now and removed when the last
+   * operation finishes. Members started with a reuse directive are left running, as they are
+   * when dropped.
+   *
+   * @throws Error listing every member that could not be removed, after all were attempted.
+   */
+  void teardown();
+
+  /// Give the members back without tearing them down.
+  std::vector<Container> release() noexcept;
+
+private:
+  ContainerGroupOptions options_;
+  // A deque keeps references returned by add() valid
+  std::deque<Container> containers_;
+};
+
+} // namespace testcontainers
@@ -0,0 +1,298 @@
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "testcontainers/ContainerPool.hpp"
+#include "testcontainers/Error.hpp"
+#include "testcontainers/Future.hpp"
+#include "testcontainers/core/ExecCommand.hpp"
+#include "testcontainers/core/SyncExecResult.hpp"
+
+namespace testcontainers {
+
+namespace {
+
+void remove_quietly(Container container) noexcept {
+  try {
+    Container::rm(std::move(container));
+  } catch (...) {
+    // Removal failures must not escape destructors or the reset thread
+  }
+}
+
+bool reset(const Container &container, const std::vector<std::string> &reset_cmd) noexcept {
+  if (reset_cmd.empty()) {
+    return false;
+  }
+  try {
+    if (!container.is_running()) {
+      return false;
+    }
+    auto result = container.exec(ExecCommand(reset_cmd));
+    // The exit code is only known once the output has been drained
+    result.stdout_bytes();
+    auto exit_code = result.exit_code();
+    return exit_code.has_value() && *exit_code == 0;
+  } catch (...) {
+    return false;
+  }
+}
+
+} // namespace
+
+struct ContainerPool::State {
+  struct Slot {
+    RequestFactory factory;
+    std::deque<Container> idle;
+    std::deque<Future<Container>> starting;
+    // Starts claimed by top_up() that are not in starting yet
+    std::size_t launching = 0;
+  };
+
+  struct Returned {
+    std::string key;
+    Container container;
+    bool reusable;
+  };
+
+  explicit State(ContainerPoolOptions options) : options(std::move(options)) {}
+
+  /// Starts containers until the slot holds options.warm ready or starting ones. request, when
+  /// given, is used for the first start instead of calling the factory.
+  ///
+  /// Must be called with lock held. The lock is released while requests are built and started.
+  void top_up(std::unique_lock<std::mutex> &lock, Slot &slot,
+              std::optional<ContainerRequest> request = std::nullopt) {
+    auto held = slot.idle.size() + slot.starting.size() + slot.launching;
+    if (held >= options.warm) {
+      return;
+    }
+    auto count = options.warm - held;
+    slot.launching += count;
+    lock.unlock();
+
+    std::vector<Future<Container>> started;
+    std::exception_ptr error;
+    try {
+      for (std::size_t i = 0; i < count; ++i) {
+        started.push_back(request ? request->start_async() : slot.factory().start_async());
+        request.reset();
+      }
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    lock.lock();
+    slot.launching -= count;
+    for (auto &future : started) {
+      slot.starting.push_back(std::move(future));
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+  void run() noexcept {
+    std::unique_lock lock(mutex);
+    while (true) {
+      cv.wait(lock, [this] { return closed || !returned.empty(); });
+      if (returned.empty()) {
+        return;
+      }
+
+      auto item = std::move(returned.front());
+      returned.pop_front();
+      lock.unlock();
+
+      bool reusable = item.reusable && reset(item.container, options.reset_cmd);
+
+      lock.lock();
+      auto &slot = slots.at(item.key);
+      if (!closed && reusable && slot.idle.size() + slot.starting.size() < options.warm) {
+        slot.idle.push_back(std::move(item.container));
+        continue;
+      }
+
+      lock.unlock();
+      remove_quietly(std::move(item.container));
+      lock.lock();
+
+      if (!closed) {
+        try {
+          top_up(lock, slot);
+        } catch (...) {
+          // A failing factory surfaces on the next lease() of this spec
+        }
+      }
+    }
+  }
+
+  const ContainerPoolOptions options;
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::unordered_map<std::string, Slot> slots;
+  std::deque<Returned> returned;
+  bool closed = false;
+  std::thread worker;
+};
+
+ContainerPool::Lease::Lease(std::shared_ptr<State> state, std::string key,
+                            Container container) noexcept
+    : state_(std::move(state)), key_(std::move(key)), container_(std::move(container)) {}
+
+ContainerPool::Lease::Lease(Lease &&other) noexcept = default;
+
+ContainerPool::Lease &ContainerPool::Lease::operator=(Lease &&other) noexcept {
+  if (this != &other) {
+    release();
+    state_ = std::move(other.state_);
+    key_ = std::move(other.key_);
+    container_ = std::move(other.container_);
+    other.container_.reset();
+  }
+  return *this;
+}
+
+ContainerPool::Lease::~Lease() noexcept { release(); }
+
+bool ContainerPool::Lease::is_valid() const noexcept {
+  return container_.has_value() && container_->is_valid();
+}
+
+void ContainerPool::Lease::release() noexcept { give_back(true); }
+
+void ContainerPool::Lease::discard() noexcept { give_back(false); }
+
+void ContainerPool::Lease::give_back(bool reusable) noexcept {
+  if (!is_valid() || !state_) {
+    container_.reset();
+    return;
+  }
+
+  auto container = std::move(*container_);
+  container_.reset();
+
+  {
+    std::lock_guard lock(state_->mutex);
+    if (!state_->closed) {
+      state_->returned.push_back({std::move(key_), std::move(container), reusable});
+      state_->cv.notify_one();
+      state_.reset();
+      return;
+    }
+  }
+
+  state_.reset();
+  remove_quietly(std::move(container));
+}
+
+ContainerPool::ContainerPool(ContainerPoolOptions options)
+    : state_(std::make_shared<State>(std::move(options))) {
+  state_->worker = std::thread([state = state_.get()] { state->run(); });
+}
+
+ContainerPool::ContainerPool(ContainerPool &&other) noexcept = default;
+
+ContainerPool &ContainerPool::operator=(ContainerPool &&other) noexcept {
+  if (this != &other) {
+    ContainerPool closing(std::move(*this));
+    state_ = std::move(other.state_);
+  }
+  return *this;
+}
+
+ContainerPool::~ContainerPool() noexcept {
+  if (!state_) {
+    return;
+  }
+
+  {
+    std::lock_guard lock(state_->mutex);
+    state_->closed = true;
+  }
+  state_->cv.notify_one();
+  state_->worker.join();
+
+  // Leases ending from now on remove their container themselves, so the slots are ours
+  for (auto &[key, slot] : state_->slots) {
+    for (auto &container : slot.idle) {
+      remove_quietly(std::move(container));
+    }
+    for (auto &future : slot.starting) {
+      try {
+        remove_quietly(future.get());
+      } catch (...) {
+        // The container never started
+      }
+    }
+  }
+  state_->slots.clear();
+}
+
+ContainerPool::Lease ContainerPool::lease(const RequestFactory &factory) {
+  // The request built to find the spec is used for the first start this lease causes
+  std::optional<ContainerRequest> request(factory());
+  auto key = request->spec_key();
+
+  std::optional<Container> container;
+  std::optional<Future<Container>> pending;
+  std::optional<ContainerRequest> direct;
+  {
+    std::unique_lock lock(state_->mutex);
+    auto &slot = state_->slots.try_emplace(key, State::Slot{factory, {}, {}}).first->second;
+
+    if (!slot.idle.empty()) {
+      container.emplace(std::move(slot.idle.front()));
+      slot.idle.pop_front();
+    } else if (!slot.starting.empty()) {
+      auto ready = std::find_if(slot.starting.begin(), slot.starting.end(),
+                                [](const auto &future) { return future.is_ready(); });
+      if (ready == slot.starting.end()) {
+        ready = slot.starting.begin();
+      }
+      pending.emplace(std::move(*ready));
+      slot.starting.erase(ready);
+    } else {
+      direct = std::move(request);
+      request.reset();
+    }
+    state_->top_up(lock, slot, std::move(request));
+  }
+
+  if (!container) {
+    container.emplace(pending ? pending->get() : direct->start());
+  }
+  return Lease(state_, std::move(key), std::move(*container));
+}
+
+void ContainerPool::prewarm(const RequestFactory &factory) {
+  auto request = factory();
+  auto key = request.spec_key();
+
+  std::unique_lock lock(state_->mutex);
+  auto &slot = state_->slots.try_emplace(key, State::Slot{factory, {}, {}}).first->second;
+  state_->top_up(lock, slot, std::move(request));
+}
+
+std::size_t ContainerPool::ready(const RequestFactory &factory) const {
+  auto key = factory().spec_key();
+
+  std::lock_guard lock(state_->mutex);
+  auto slot = state_->slots.find(key);
+  if (slot == state_->slots.end()) {
+    return 0;
+  }
+  auto &starting = slot->second.starting;
+  return slot->second.idle.size() +
+         static_cast<std::size_t>(std::count_if(starting.begin(), starting.end(),
+                                                [](const auto &f) { return f.is_ready(); }));
+}
+
+} // namespace testcontainers
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "testcontainers/Container.hpp"
+#include "testcontainers/ContainerRequest.hpp"
+
+namespace testcontainers {
+
+struct ContainerPoolOptions {
+  /// Number of started containers kept ready for every spec.
+  std::size_t warm = 1;
+
+  /**
+   * Command run in a returned container. The container is leased again only if the command
+   * exits with 0, otherwise it is removed and replaced. When empty, every returned container
+   * is replaced.
+   */
+  std::vector<std::string> reset_cmd;
+};
+
+/**
+ * @brief Keeps pre-started containers ready and hands them out as leases.
+ *
+ * Containers are grouped by ContainerRequest::spec_key(), so factories that build the same
+ * request share one set of warm containers. Returned containers are reset or removed on a
+ * background thread, replacements are started with ContainerRequest::start_async().
+ *
+ * Example:
+ * @code
+ * ContainerPool pool({.warm = 2, .reset_cmd = {"redis-cli", "FLUSHALL"}});
+ *
+ * auto redis = pool.lease([] { return GenericImage("redis", "7").with_cmd({"redis-server"}); });
+ * redis->exec(ExecCommand({"redis-cli", "SET", "key", "value"}));
+ * @endcode
+ */
+class ContainerPool final {
+  struct State;
+
+public:
+  using RequestFactory = std::function<ContainerRequest()>;
+
+  /**
+   * @brief Exclusive use of a pooled container, returned to the pool on destruction.
+   */
+  class Lease final {
+  public:
+    Lease(Lease &&other) noexcept;
+    Lease &operator=(Lease &&other) noexcept;
+    ~Lease() noexcept;
+    Lease(const Lease &) = delete;
+    Lease &operator=(const Lease &) = delete;
+
+    bool is_valid() const noexcept;
+
+    const Container &container() const noexcept { return *container_; }
+    const Container &operator*() const noexcept { return *container_; }
+    const Container *operator->() const noexcept { return &*container_; }
+
+    /// Return the container to the pool before the lease goes out of scope.
+    void release() noexcept;
+
+    /// Return the container without resetting it, it is removed and replaced.
+    void discard() noexcept;
+
+  private:
+    friend class ContainerPool;
+
+    Lease(std::shared_ptr<State> state, std::string key, Container container) noexcept;
+
+    void give_back(bool reusable) noexcept;
+
+  private:
+    std::shared_ptr<State> state_;
+    std::string key_;
+    std::optional<Container> container_;
+  };
+
+public:
+  explicit ContainerPool(ContainerPoolOptions options = {});
+  ContainerPool(ContainerPool &&other) noexcept;
+  ContainerPool &operator=(ContainerPool &&other) noexcept;
+
+  /// Removes idle containers. Containers still leased are removed when their lease ends.
+  ~ContainerPool() noexcept;
+  ContainerPool(const ContainerPool &) = delete;
+  ContainerPool &operator=(const ContainerPool &) = delete;
+
+  /**
+   * @brief Take a ready container for the spec built by factory.
+   *
+   * Falls back to starting the request directly when nothing is ready, and starts replacements
+   * in the background so the spec stays warm. factory is called once to find the spec, and
+   * again only for starts beyond the first.
+   *
+   * @throws Error if the container fails to start.
+   */
+  Lease lease(const RequestFactory &factory);
+
+  /// Start the warm containers for the spec built by factory without leasing one.
+  void prewarm(const RequestFactory &factory);
+
+  /// Number of started containers ready to be leased for the spec built by factory.
+  std::size_t ready(const RequestFactory &factory) const;
+
+private:
+  std::shared_ptr<State> state_;
+};
+
+} // namespace testcontainers
@@ -1,13 +1,17 @@
+#include <algorithm>
+
 #include <rust/cxx.h>
 #include <rust_tc_bridge/lib.h>
 
 #include "testcontainers/Container.hpp"
 #include "testcontainers/ContainerRequest.hpp"
+#include "testcontainers/ContainerSpec.hpp"
 #include "testcontainers/core/CgroupnsMode.hpp"
 #include "testcontainers/core/CopyDataSource.hpp"
 #include "testcontainers/core/Healthcheck.hpp"
 #include "testcontainers/core/Host.hpp"
 #include "testcontainers/core/Mount.hpp"
+#include "testcontainers/core/ReuseDirective.hpp"
 #include "testcontainers/core/wait/WaitFor.hpp"
 #include "details/OptionHelper.hpp"
 #include "details/VectorHelper.hpp"
@@ -15,14 +19,104 @@
 
 #include "details/BoxHelper.hpp"
 #include "details/ErrorHelper.hpp"
+#include "details/LogConsumerHelper.hpp"
 
 namespace testcontainers {
 
+namespace {
+
+constexpr std::string_view kReuseKeyLabel = "org.testcontainers.cxx.reuse-key";
+
+RsPortSpec to_rs_port(const ContainerSpec::Port &port) {
+  switch (port.protocol) {
+  case ContainerSpec::Protocol::Udp:
+    return RsPortSpec{port.port, RsContainerPortType::Udp};
+  case ContainerSpec::Protocol::Sctp:
+    return RsPortSpec{port.port, RsContainerPortType::Sctp};
+  default:
+    return RsPortSpec{port.port, RsContainerPortType::Tcp};
+  }
+}
+
+RsMountType to_rs_mount_type(ContainerSpec::Mount::Type type) {
+  switch (type) {
+  case ContainerSpec::Mount::Type::Volume:
+    return RsMountType::Volume;
+  case ContainerSpec::Mount::Type::Tmpfs:
+    return RsMountType::Tmpfs;
+  default:
+    return RsMountType::Bind;
+  }
+}
+
+void split_pairs(const std::vector<std::pair<std::string, std::string>> &pairs,
+                 rust::Vec<rust::String> &keys, rust::Vec<rust::String> &values) {
+  keys.reserve(pairs.size());
+  values.reserve(pairs.size());
+  for (const auto &[key, value] : pairs) {
+    keys.emplace_back(key);
+    values.emplace_back(value);
+  }
+}
+
+rust::Vec<rust::String> string_opt(const std::optional<std::string> &opt) {
+  return utils::optional_to_vec<rust::String>(std::optional(opt));
+}
+
+} // namespace
+
 ContainerRequest::ContainerRequest(RsContainerRequest *container_request) noexcept
     : rimpl_(container_request, [](RsContainerRequest *cr) {
         ::rs_container_request_destroy(details::box_from_raw(cr));
       }) {}
 
+ContainerRequest ContainerRequest::from_spec(const ContainerSpec &spec) {
+  spec.validate();
+
+  RsContainerSpec rs_spec{};
+  rs_spec.name = spec.name;
+  rs_spec.tag = spec.tag;
+  rs_spec.entrypoint_opt = string_opt(spec.entrypoint);
+  rs_spec.cmd = utils::vector_to_vec<rust::String>(spec.cmd);
+
+  rs_spec.exposed_ports.reserve(spec.exposed_ports.size());
+  for (const auto &port : spec.exposed_ports) {
+    rs_spec.exposed_ports.push_back(to_rs_port(port));
+  }
+  rs_spec.mapped_ports.reserve(spec.mapped_ports.size());
+  for (const auto &mapping : spec.mapped_ports) {
+    rs_spec.mapped_ports.push_back(
+        RsPortMappingSpec{mapping.host_port, to_rs_port(mapping.container_port)});
+  }
+
+  split_pairs(spec.env_vars, rs_spec.env_keys, rs_spec.env_values);
+  split_pairs(spec.labels, rs_spec.label_keys, rs_spec.label_values);
+
+  rs_spec.mounts.reserve(spec.mounts.size());
+  for (const auto &mount : spec.mounts) {
+    rs_spec.mounts.push_back(RsMountSpec{to_rs_mount_type(mount.type), mount.source,
+                                         mount.target, mount.read_only});
+  }
+
+  rs_spec.container_name_opt = string_opt(spec.container_name);
+  rs_spec.hostname_opt = string_opt(spec.hostname);
+  rs_spec.network_opt = string_opt(spec.network);
+  rs_spec.platform_opt = string_opt(spec.platform);
+  rs_spec.working_dir_opt = string_opt(spec.working_dir);
+  rs_spec.user_opt = string_opt(spec.user);
+  rs_spec.userns_mode_opt = string_opt(spec.userns_mode);
+  rs_spec.privileged = spec.privileged;
+  rs_spec.readonly_rootfs = spec.readonly_rootfs;
+  rs_spec.shm_size_opt = utils::optional_to_vec(std::optional(spec.shm_size));
+  rs_spec.startup_timeout_ns_opt = utils::optional_to_vec<std::uint64_t>(
+      std::optional(spec.startup_timeout), [](auto timeout) { return timeout.count(); });
+  rs_spec.cap_add = utils::vector_to_vec<rust::String>(spec.cap_add);
+  rs_spec.cap_drop = utils::vector_to_vec<rust::String>(spec.cap_drop);
+  rs_spec.security_opts = utils::vector_to_vec<rust::String>(spec.security_opts);
+
+  return ContainerRequest(::rs_container_request_from_spec(std::move(rs_spec)).into_raw());
+}
+
 ContainerRequest::ContainerRequest(ContainerRequest &&other) noexcept = default;
 
 ContainerRequest &ContainerRequest::operator=(ContainerRequest &&other) noexcept = default;
@@ -31,6 +125,10 @@ ContainerRequest::~ContainerRequest() noexcept = default;
 
 bool ContainerRequest::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
 
+ContainerRequest ContainerRequest::clone() const {
+  return ContainerRequest(::rs_container_request_clone(*rimpl_).into_raw());
+}
+
 ContainerRequest ContainerRequest::with_cmd(const std::vector<std::string> &cmd) {
   return ContainerRequest(
       ::rs_container_request_with_cmd(details::into_box(rimpl_),
@@ -173,6 +271,26 @@ ContainerRequest ContainerRequest::with_working_dir(std::string_view working_dir
                               .into_raw());
 }
 
+ContainerRequest ContainerRequest::with_log_consumer(LogConsumer consumer) {
+  auto callback = details::make_log_consumer_callback(std::move(consumer));
+  return ContainerRequest(
+      ::rs_container_request_with_log_consumer(details::into_box(rimpl_), std::move(callback))
+          .into_raw());
+}
+
+ContainerRequest ContainerRequest::with_reuse(ReuseDirective reuse) {
+  return ContainerRequest(::rs_container_request_with_reuse(details::into_box(rimpl_),
+                                                            details::into_box(reuse.rimpl_))
+                              .into_raw());
+}
+
+ContainerRequest ContainerRequest::with_reuse_key(std::string_view key) {
+  auto request = with_reuse(ReuseDirective::Always());
+  // Without the label any running container of the same name and network would match
+  auto label = key.empty() ? request.spec_key() : std::string(key);
+  return request.with_label(kReuseKeyLabel, label);
+}
+
 ContainerRequest ContainerRequest::with_user(std::string_view user) {
   return ContainerRequest(
       ::rs_container_request_with_user(details::into_box(rimpl_), details::into_string(user))
@@ -203,6 +321,7 @@ ContainerRequest ContainerRequest::with_ready_conditions(std::vector<WaitFor> re
 }
 
 ContainerRequest ContainerRequest::with_copy_to(std::string_view target, CopyDataSource source) {
+  source.check_copyable_by_request();
   return ContainerRequest(::rs_container_request_with_copy_to(details::into_box(rimpl_),
                                                               details::into_string(target),
                                                               details::into_box(source.rimpl_))
@@ -236,4 +355,69 @@ ContainerRequest ContainerRequest::pull() {
                           }).into_raw());
 }
 
+Future<Container> ContainerRequest::start_async() {
+  return Future<Container>(
+      ::rs_container_request_start_async(details::into_box(rimpl_)).into_raw());
+}
+
+Future<ContainerRequest> ContainerRequest::pull_async() {
+  return Future<ContainerRequest>(
+      ::rs_container_request_pull_async(details::into_box(rimpl_)).into_raw());
+}
+
+std::string ContainerRequest::spec_key() const {
+  return std::string(::rs_container_request_spec_key(*rimpl_));
+}
+
+std::vector<Container> ContainerRequest::start_all(std::vector<ContainerRequest> requests) {
+  auto results = try_start_all(std::move(requests));
+
+  std::vector<Container> containers;
+  containers.reserve(results.size());
+  std::string errors;
+
+  for (auto &result : results) {
+    if (auto *container = std::get_if<Container>(&result)) {
+      containers.push_back(std::move(*container));
+    } else {
+      if (!errors.empty()) {
+        errors += "; ";
+      }
+      errors += std::get<Error>(result).what();
+    }
+  }
+
+  if (!errors.empty()) {
+    throw Error(std::move(errors));
+  }
+  return containers;
+}
+
+std::vector<std::variant<Container, Error>>
+ContainerRequest::try_start_all(std::vector<ContainerRequest> requests) {
+  rust::Vec<RsContainerRequest> rust_requests;
+  rust_requests.reserve(requests.size());
+  for (auto &request : requests) {
+    ::rs_container_request_vec_push(rust_requests, details::into_box(request.rimpl_));
+  }
+
+  auto rust_results = ::rs_container_request_start_all(std::move(rust_requests));
+  std::vector<std::variant<Container, Error>> results;
+  results.reserve(rust_results.size());
+
+  while (!rust_results.empty()) {
+    auto result = ::rs_container_start_result_vec_pop(rust_results);
+    try {
+      results.emplace_back(Container(
+          details::call_map_error(::rs_container_start_result_into_container, std::move(result))
+              .into_raw()));
+    } catch (const Error &e) {
+      results.emplace_back(e);
+    }
+  }
+
+  std::reverse(results.begin(), results.end());
+  return results;
+}
+
 } // namespace testcontainers
@@ -4,9 +4,13 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <variant>
 #include <vector>
 
+#include "testcontainers/Error.hpp"
 #include "testcontainers/interfaces/IImageExt.hpp"
+#include "testcontainers/interfaces/IAsyncRunner.hpp"
+#include "testcontainers/interfaces/ICloneable.hpp"
 #include "testcontainers/interfaces/IRustObject.hpp"
 #include "testcontainers/interfaces/ISyncRunner.hpp"
 
@@ -15,8 +19,24 @@ class RsContainerRequest;
 namespace testcontainers {
 
 class Container;
+struct ContainerSpec;
 
-class ContainerRequest final : public IRustObject, public IImageExt, public ISyncRunner {
+/**
+ * @brief Fully configured container request, produced by the with_* methods of GenericImage.
+ *
+ * Requests are move-only, clone() stamps out copies of a configured template:
+ * @code
+ * auto base = GenericImage("redis", "7").with_env_var("REDIS_ARGS", "--save ''");
+ *
+ * std::vector<ContainerRequest> requests;
+ * for (int i = 0; i < 4; ++i) {
+ *     requests.push_back(base.clone());
+ * }
+ * auto containers = ContainerRequest::start_all(std::move(requests));
+ * @endcode
+ */
+class ContainerRequest final : public IRustObject, public ICloneable<ContainerRequest>,
+                               public IImageExt, public ISyncRunner, public IAsyncRunner {
 public: // Default construction methods
   ContainerRequest(ContainerRequest &&other) noexcept;
   ContainerRequest &operator=(ContainerRequest &&other) noexcept;
@@ -24,9 +44,21 @@ public: // Default construction methods
   ContainerRequest(const ContainerRequest &) = delete;
   ContainerRequest &operator=(const ContainerRequest &) = delete;
 
+public: // Static factory methods
+  /**
+   * @brief Build a request from a whole spec in a single bridge call.
+   *
+   * @throws Error if the spec fails ContainerSpec::validate().
+   */
+  static ContainerRequest from_spec(const ContainerSpec &spec);
+
 public: // IRustObject interface
   bool is_valid() const noexcept override;
 
+public: // ICloneable interface
+  /// Independent copy of the request that can be configured and started on its own.
+  ContainerRequest clone() const override;
+
 public: // IImageExt interface
   ContainerRequest with_cmd(const std::vector<std::string> &cmd) override;
   ContainerRequest with_name(std::string_view name) override;
@@ -52,6 +84,9 @@ public: // IImageExt interface
   ContainerRequest
   with_startup_timeout(std::chrono::duration<std::uint64_t, std::nano> timeout) noexcept override;
   ContainerRequest with_working_dir(std::string_view working_dir) override;
+  ContainerRequest with_log_consumer(LogConsumer consumer) override;
+  ContainerRequest with_reuse(ReuseDirective reuse) override;
+  ContainerRequest with_reuse_key(std::string_view key = {}) override;
   ContainerRequest with_user(std::string_view user) override;
   ContainerRequest with_readonly_rootfs(bool readonly_rootfs) noexcept override;
   ContainerRequest with_security_opt(std::string_view security_opt) override;
@@ -65,8 +100,44 @@ public: // ISyncRunner interface
   Container start() override;
   ContainerRequest pull() override;
 
+public: // IAsyncRunner interface
+  Future<Container> start_async() override;
+  Future<ContainerRequest> pull_async() override;
+
+public: // Batch runners
+  /**
+   * @brief Start all requests concurrently.
+   *
+   * Containers are returned in the same order as requests.
+   *
+   * @throws Error if any request fails to start. Containers that did start are removed.
+   */
+  static std::vector<Container> start_all(std::vector<ContainerRequest> requests);
+
+  /**
+   * @brief Start all requests concurrently, reporting failures per request.
+   *
+   * Each element holds either the started container or the error of the corresponding request.
+   */
+  static std::vector<std::variant<Container, Error>>
+  try_start_all(std::vector<ContainerRequest> requests);
+
+public: // Helper methods
+  /**
+   * @brief Key shared by all requests that start identical containers.
+   *
+   * Independent of the order in which options were applied, used by ContainerPool to group
+   * interchangeable containers. Copied data enters the key as a digest. The key is the same in
+   * every process of a build, so it can identify containers left running by an earlier run.
+   *
+   * @note Keys are not stable across library upgrades. After an upgrade, containers left running
+   * under a derived reuse key are no longer matched and a new one is started.
+   */
+  std::string spec_key() const;
+
 private:
   friend class GenericImage;
+  template <typename T> friend class Future;
 
   explicit ContainerRequest(RsContainerRequest *container_request) noexcept;
 
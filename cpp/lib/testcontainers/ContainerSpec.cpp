@@ -0,0 +1,46 @@
+#include <string>
+
+#include "testcontainers/ContainerSpec.hpp"
+#include "testcontainers/Error.hpp"
+
+namespace testcontainers {
+
+void ContainerSpec::validate() const {
+  if (name.empty()) {
+    throw Error("Invalid container spec: image name is empty");
+  }
+  if (tag.empty()) {
+    throw Error("Invalid container spec: image tag is empty");
+  }
+  for (const auto &port : exposed_ports) {
+    if (port.port == 0) {
+      throw Error("Invalid container spec: exposed port 0");
+    }
+  }
+  for (const auto &mapping : mapped_ports) {
+    if (mapping.host_port == 0 || mapping.container_port.port == 0) {
+      throw Error("Invalid container spec: mapped port 0");
+    }
+  }
+  for (const auto &[key, value] : env_vars) {
+    if (key.empty() || key.find('=') != std::string::npos) {
+      throw Error("Invalid container spec: environment variable name '" + key + "'");
+    }
+  }
+  for (const auto &[key, value] : labels) {
+    if (key.empty()) {
+      throw Error("Invalid container spec: empty label key");
+    }
+  }
+  for (const auto &mount : mounts) {
+    if (mount.target.empty() || mount.target.front() != '/') {
+      throw Error("Invalid container spec: mount target '" + mount.target +
+                  "' is not an absolute path");
+    }
+    if (mount.type != Mount::Type::Tmpfs && mount.source.empty()) {
+      throw Error("Invalid container spec: mount source for '" + mount.target + "' is empty");
+    }
+  }
+}
+
+} // namespace testcontainers
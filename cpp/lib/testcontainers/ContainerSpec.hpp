@@ -0,0 +1,89 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace testcontainers {
+
+/**
+ * @brief Plain C++ description of a container, converted to a ContainerRequest in one call.
+ *
+ * Every with_* call on GenericImage or ContainerRequest is a round trip into the Rust bridge.
+ * A ContainerSpec is filled in without touching the bridge, can be validated up front and
+ * shared as a const fixture, and ContainerRequest::from_spec() turns it into a request at once.
+ * Options without a field here (wait conditions, health checks, log consumers, ...) are still
+ * applied with the builder methods on the returned request.
+ *
+ * Example:
+ * @code
+ * static const ContainerSpec redis_spec{
+ *     .name = "redis",
+ *     .tag = "7",
+ *     .exposed_ports = {{6379}},
+ *     .env_vars = {{"REDIS_ARGS", "--save ''"}},
+ * };
+ *
+ * auto container = ContainerRequest::from_spec(redis_spec).start();
+ * @endcode
+ */
+struct ContainerSpec {
+  enum class Protocol : std::uint8_t { Tcp, Udp, Sctp };
+
+  struct Port {
+    std::uint16_t port = 0;
+    Protocol protocol = Protocol::Tcp;
+  };
+
+  struct PortMapping {
+    std::uint16_t host_port = 0;
+    Port container_port;
+  };
+
+  struct Mount {
+    enum class Type : std::uint8_t { Bind, Volume, Tmpfs };
+
+    Type type = Type::Bind;
+    /// Host path for bind mounts, volume name for volume mounts, unused for tmpfs.
+    std::string source;
+    std::string target;
+    bool read_only = false;
+  };
+
+  std::string name;
+  std::string tag = "latest";
+  std::optional<std::string> entrypoint;
+  /// Overrides the image command, the image default is kept when empty.
+  std::vector<std::string> cmd;
+  std::vector<Port> exposed_ports;
+  std::vector<PortMapping> mapped_ports;
+  std::vector<std::pair<std::string, std::string>> env_vars;
+  std::vector<std::pair<std::string, std::string>> labels;
+  std::vector<Mount> mounts;
+  std::optional<std::string> container_name;
+  std::optional<std::string> hostname;
+  std::optional<std::string> network;
+  std::optional<std::string> platform;
+  std::optional<std::string> working_dir;
+  std::optional<std::string> user;
+  std::optional<std::string> userns_mode;
+  bool privileged = false;
+  bool readonly_rootfs = false;
+  std::optional<std::uint64_t> shm_size;
+  std::optional<std::chrono::duration<std::uint64_t, std::nano>> startup_timeout;
+  std::vector<std::string> cap_add;
+  std::vector<std::string> cap_drop;
+  std::vector<std::string> security_opts;
+
+  /**
+   * @brief Check the spec for values Docker would reject.
+   *
+   * @throws Error naming the first invalid field.
+   */
+  void validate() const;
+};
+
+} // namespace testcontainers
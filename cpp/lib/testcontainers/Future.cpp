@@ -0,0 +1,69 @@
+#include <rust/cxx.h>
+#include <rust_tc_bridge/lib.h>
+
+#include "testcontainers/Future.hpp"
+#include "testcontainers/Container.hpp"
+#include "testcontainers/ContainerRequest.hpp"
+#include "testcontainers/core/SyncExecResult.hpp"
+
+#include "details/AsyncWaker.hpp"
+#include "details/BoxHelper.hpp"
+#include "details/ErrorHelper.hpp"
+
+namespace testcontainers {
+
+template <typename T>
+Future<T>::Future(RsAsyncTask *task) noexcept
+    : rimpl_(task, [](RsAsyncTask *t) { ::rs_async_task_destroy(details::box_from_raw(t)); }) {}
+
+template <typename T> Future<T>::Future(Future &&other) noexcept = default;
+
+template <typename T> Future<T> &Future<T>::operator=(Future &&other) noexcept = default;
+
+template <typename T> Future<T>::~Future() noexcept = default;
+
+template <typename T> bool Future<T>::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
+
+template <typename T> bool Future<T>::is_ready() const noexcept {
+  return rimpl_->rs_async_task_is_ready();
+}
+
+template <typename T> void Future<T>::wait() const noexcept { rimpl_->rs_async_task_wait(); }
+
+template <typename T>
+bool Future<T>::wait_for(std::chrono::duration<std::uint64_t, std::nano> timeout) const noexcept {
+  return rimpl_->rs_async_task_wait_for(timeout.count());
+}
+
+template <typename T> void Future<T>::on_ready(std::function<void()> callback) const {
+  rimpl_->rs_async_task_on_ready(std::make_unique<details::AsyncWaker>(std::move(callback)));
+}
+
+template <> void Future<void>::get() {
+  details::call_map_error(::rs_async_task_into_unit, details::into_box(rimpl_));
+}
+
+template <> Container Future<Container>::get() {
+  return Container(
+      details::call_map_error(::rs_async_task_into_container, details::into_box(rimpl_))
+          .into_raw());
+}
+
+template <> ContainerRequest Future<ContainerRequest>::get() {
+  return ContainerRequest(
+      details::call_map_error(::rs_async_task_into_container_request, details::into_box(rimpl_))
+          .into_raw());
+}
+
+template <> SyncExecResult Future<SyncExecResult>::get() {
+  return SyncExecResult(
+      details::call_map_error(::rs_async_task_into_exec_result, details::into_box(rimpl_))
+          .into_raw());
+}
+
+template class Future<void>;
+template class Future<Container>;
+template class Future<ContainerRequest>;
+template class Future<SyncExecResult>;
+
+} // namespace testcontainers
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#if defined(__cpp_impl_coroutine)
+#include <atomic>
+#include <coroutine>
+#endif
+
+#include "testcontainers/interfaces/IRustObject.hpp"
+
+class RsAsyncTask;
+
+namespace testcontainers {
+
+class Container;
+class ContainerRequest;
+class GenericImage;
+class SyncExecResult;
+
+/**
+ * @brief Handle to an operation running on the shared runtime.
+ *
+ * The operation makes progress without the caller blocking; get() waits for it and returns
+ * its result. Destroying an unconsumed Future detaches the operation and drops its result.
+ *
+ * Example:
+ * @code
+ * auto redis = GenericImage("redis", "7.2.4").start_async();
+ * auto postgres = GenericImage("postgres", "16").start_async();
+ * // Both containers are starting at the same time...
+ * auto redis_container = redis.get();
+ * auto postgres_container = postgres.get();
+ * @endcode
+ *
+ * With C++20 coroutines a Future is awaitable, suspending the coroutine instead of a thread:
+ * @code
+ * auto container = co_await GenericImage("redis", "7.2.4").start_async();
+ * @endcode
+ * The coroutine is resumed on a runtime thread.
+ */
+template <typename T> class Future final : public IRustObject {
+public: // Default construction methods
+  Future(Future &&other) noexcept;
+  Future &operator=(Future &&other) noexcept;
+  ~Future() noexcept;
+  Future(const Future &) = delete;
+  Future &operator=(const Future &) = delete;
+
+public: // IRustObject interface
+  bool is_valid() const noexcept override;
+
+public:
+  bool is_ready() const noexcept;
+  void wait() const noexcept;
+  bool wait_for(std::chrono::duration<std::uint64_t, std::nano> timeout) const noexcept;
+
+  /**
+   * @brief Wait for the operation and take its result, invalidating the Future.
+   *
+   * @throws Error if the operation failed.
+   */
+  T get();
+
+  /**
+   * @brief Invoke callback once, on a runtime thread, when the operation completes.
+   *
+   * If the operation has already completed the callback is invoked right away.
+   * The Future must still be kept to retrieve the result with get().
+   */
+  void on_ready(std::function<void()> callback) const;
+
+#if defined(__cpp_impl_coroutine)
+  class Awaiter;
+
+  Awaiter operator co_await() && noexcept;
+#endif
+
+private:
+  friend class Container;
+  friend class ContainerRequest;
+  friend class GenericImage;
+
+  explicit Future(RsAsyncTask *task) noexcept;
+
+private:
+  std::unique_ptr<RsAsyncTask, void (*)(RsAsyncTask *)> rimpl_;
+};
+
+#if defined(__cpp_impl_coroutine)
+template <typename T> class Future<T>::Awaiter final {
+public:
+  explicit Awaiter(Future future) noexcept : future_(std::move(future)) {}
+
+  bool await_ready() const noexcept { return future_.is_ready(); }
+
+  bool await_suspend(std::coroutine_handle<> handle) {
+    // Whoever comes second resumes: the callback, or this function if the callback already ran
+    auto armed = std::make_shared<std::atomic<bool>>(false);
+    future_.on_ready([handle, armed] {
+      if (armed->exchange(true)) {
+        handle.resume();
+      }
+    });
+    return !armed->exchange(true);
+  }
+
+  T await_resume() { return future_.get(); }
+
+private:
+  Future future_;
+};
+
+template <typename T> typename Future<T>::Awaiter Future<T>::operator co_await() && noexcept {
+  return Awaiter(std::move(*this));
+}
+#endif
+
+template <> void Future<void>::get();
+template <> Container Future<Container>::get();
+template <> ContainerRequest Future<ContainerRequest>::get();
+template <> SyncExecResult Future<SyncExecResult>::get();
+
+extern template class Future<void>;
+extern template class Future<Container>;
+extern template class Future<ContainerRequest>;
+extern template class Future<SyncExecResult>;
+
+} // namespace testcontainers
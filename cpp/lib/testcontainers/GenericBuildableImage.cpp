@@ -1,7 +1,6 @@
 #include <rust/cxx.h>
 #include <rust_tc_bridge/lib.h>
 
-#include "details/VectorHelper.hpp"
 #include "testcontainers/GenericBuildableImage.hpp"
 #include "testcontainers/GenericImage.hpp"
 #include "testcontainers/system/Path.hpp"
@@ -56,11 +55,23 @@ GenericBuildableImage GenericBuildableImage::with_file(const std::filesystem::pa
 
 GenericBuildableImage GenericBuildableImage::with_data(const std::vector<std::uint8_t> &data,
                                                        std::string_view target) {
-  return GenericBuildableImage(
-      ::rs_generic_buildable_image_with_data(details::into_box(rimpl_),
-                                             utils::vector_to_vec(std::move(data)),
-                                             details::into_string(target))
-          .into_raw());
+  return with_data(std::span<const std::uint8_t>(data), target);
+}
+
+GenericBuildableImage GenericBuildableImage::with_data(std::span<const std::uint8_t> data,
+                                                       std::string_view target) {
+  return GenericBuildableImage(::rs_generic_buildable_image_with_data(
+                                   details::into_box(rimpl_),
+                                   rust::Slice<const std::uint8_t>(data.data(), data.size()),
+                                   details::into_string(target))
+                                   .into_raw());
+}
+
+GenericBuildableImage GenericBuildableImage::with_data(std::string_view data,
+                                                       std::string_view target) {
+  return with_data(std::span<const std::uint8_t>(
+                       reinterpret_cast<const std::uint8_t *>(data.data()), data.size()),
+                   target);
 }
 
 GenericImage GenericBuildableImage::build() {
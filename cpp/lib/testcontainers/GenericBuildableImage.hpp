@@ -2,6 +2,7 @@
 
 #include <filesystem>
 #include <memory>
+#include <span>
 #include <string_view>
 #include <vector>
 
@@ -38,6 +39,9 @@ public: // IBuildableImage interface
                                   std::string_view target) override;
   GenericBuildableImage with_data(const std::vector<std::uint8_t> &data,
                                   std::string_view target) override;
+  GenericBuildableImage with_data(std::span<const std::uint8_t> data,
+                                  std::string_view target) override;
+  GenericBuildableImage with_data(std::string_view data, std::string_view target) override;
 
 public: // ISyncBuilder interface
   GenericImage build() override;
@@ -9,11 +9,13 @@
 #include "testcontainers/core/Healthcheck.hpp"
 #include "testcontainers/core/Host.hpp"
 #include "testcontainers/core/Mount.hpp"
+#include "testcontainers/core/ReuseDirective.hpp"
 #include "details/OptionHelper.hpp"
 #include "details/VectorHelper.hpp"
 
 #include "details/BoxHelper.hpp"
 #include "details/ErrorHelper.hpp"
+#include "details/LogConsumerHelper.hpp"
 
 namespace testcontainers {
 
@@ -52,6 +54,10 @@ GenericImage GenericImage::with_wait_for(WaitFor wait_for) noexcept {
 
 bool GenericImage::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
 
+GenericImage GenericImage::clone() const {
+  return GenericImage(::rs_generic_image_clone(*rimpl_).into_raw());
+}
+
 std::string GenericImage::name() const noexcept {
   return std::string(rimpl_->rs_generic_image_name());
 }
@@ -230,6 +236,25 @@ ContainerRequest GenericImage::with_working_dir(std::string_view working_dir) {
                               .into_raw());
 }
 
+ContainerRequest GenericImage::with_log_consumer(LogConsumer consumer) {
+  auto callback = details::make_log_consumer_callback(std::move(consumer));
+  return ContainerRequest(
+      ::rs_generic_image_with_log_consumer(details::into_box(rimpl_), std::move(callback))
+          .into_raw());
+}
+
+ContainerRequest GenericImage::with_reuse(ReuseDirective reuse) {
+  return ContainerRequest(::rs_generic_image_with_reuse(details::into_box(rimpl_),
+                                                        details::into_box(reuse.rimpl_))
+                              .into_raw());
+}
+
+ContainerRequest GenericImage::with_reuse_key(std::string_view key) {
+  return ContainerRequest(
+             ::rs_generic_image_into_container_request(details::into_box(rimpl_)).into_raw())
+      .with_reuse_key(key);
+}
+
 ContainerRequest GenericImage::with_user(std::string_view user) {
   return ContainerRequest(
       ::rs_generic_image_with_user(details::into_box(rimpl_), details::into_string(user))
@@ -260,6 +285,7 @@ ContainerRequest GenericImage::with_ready_conditions(std::vector<WaitFor> ready_
 }
 
 ContainerRequest GenericImage::with_copy_to(std::string_view target, CopyDataSource source) {
+  source.check_copyable_by_request();
   return ContainerRequest(::rs_generic_image_with_copy_to(details::into_box(rimpl_),
                                                           details::into_string(target),
                                                           details::into_box(source.rimpl_))
@@ -293,4 +319,32 @@ ContainerRequest GenericImage::pull() {
                           }).into_raw());
 }
 
+Future<Container> GenericImage::start_async() {
+  return Future<Container>(::rs_generic_image_start_async(details::into_box(rimpl_)).into_raw());
+}
+
+Future<ContainerRequest> GenericImage::pull_async() {
+  return Future<ContainerRequest>(
+      ::rs_generic_image_pull_async(details::into_box(rimpl_)).into_raw());
+}
+
+std::vector<Container> GenericImage::start_all(std::vector<GenericImage> images) {
+  return ContainerRequest::start_all(into_requests(std::move(images)));
+}
+
+std::vector<std::variant<Container, Error>>
+GenericImage::try_start_all(std::vector<GenericImage> images) {
+  return ContainerRequest::try_start_all(into_requests(std::move(images)));
+}
+
+std::vector<ContainerRequest> GenericImage::into_requests(std::vector<GenericImage> images) noexcept {
+  std::vector<ContainerRequest> requests;
+  requests.reserve(images.size());
+  for (auto &image : images) {
+    requests.push_back(ContainerRequest(
+        ::rs_generic_image_into_container_request(details::into_box(image.rimpl_)).into_raw()));
+  }
+  return requests;
+}
+
 } // namespace testcontainers
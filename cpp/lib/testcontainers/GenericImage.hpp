@@ -4,10 +4,14 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <variant>
 #include <vector>
 
+#include "testcontainers/Error.hpp"
 #include "testcontainers/core/ContainerPort.hpp"
 #include "testcontainers/core/wait/WaitFor.hpp"
+#include "testcontainers/interfaces/IAsyncRunner.hpp"
+#include "testcontainers/interfaces/ICloneable.hpp"
 #include "testcontainers/interfaces/IImage.hpp"
 #include "testcontainers/interfaces/IImageExt.hpp"
 #include "testcontainers/interfaces/IRustObject.hpp"
@@ -32,7 +36,12 @@ class ContainerRequest;
  *     .start();
  * @endcode
  */
-class GenericImage final : public IRustObject, public IImage, public IImageExt, public ISyncRunner {
+class GenericImage final : public IRustObject,
+                           public ICloneable<GenericImage>,
+                           public IImage,
+                           public IImageExt,
+                           public ISyncRunner,
+                           public IAsyncRunner {
 public: // Static factory methods
   /**
    * @brief Construct a new Generic Image object
@@ -52,6 +61,9 @@ public: // Default construction methods
 public: // IRustObject interface
   bool is_valid() const noexcept override;
 
+public: // ICloneable interface
+  GenericImage clone() const override;
+
 public: // Getters
   std::string name() const noexcept;
   std::string tag() const noexcept;
@@ -88,6 +100,9 @@ public: // IImageExt interface
   ContainerRequest
   with_startup_timeout(std::chrono::duration<std::uint64_t, std::nano> timeout) noexcept override;
   ContainerRequest with_working_dir(std::string_view working_dir) override;
+  ContainerRequest with_log_consumer(LogConsumer consumer) override;
+  ContainerRequest with_reuse(ReuseDirective reuse) override;
+  ContainerRequest with_reuse_key(std::string_view key = {}) override;
   ContainerRequest with_user(std::string_view user) override;
   ContainerRequest with_readonly_rootfs(bool readonly_rootfs) noexcept override;
   ContainerRequest with_security_opt(std::string_view security_opt) override;
@@ -102,10 +117,32 @@ public: // ISyncRunner interface
   Container start() override;
   ContainerRequest pull() override;
 
+public: // IAsyncRunner interface
+  Future<Container> start_async() override;
+  Future<ContainerRequest> pull_async() override;
+
+public: // Batch runners
+  /**
+   * @brief Start all images concurrently.
+   *
+   * @see ContainerRequest::start_all
+   */
+  static std::vector<Container> start_all(std::vector<GenericImage> images);
+
+  /**
+   * @brief Start all images concurrently, reporting failures per image.
+   *
+   * @see ContainerRequest::try_start_all
+   */
+  static std::vector<std::variant<Container, Error>>
+  try_start_all(std::vector<GenericImage> images);
+
 private:
   friend class GenericBuildableImage;
   explicit GenericImage(RsGenericImage *image) noexcept;
 
+  static std::vector<ContainerRequest> into_requests(std::vector<GenericImage> images) noexcept;
+
 private:
   std::unique_ptr<RsGenericImage, void (*)(RsGenericImage *)> rimpl_;
 };
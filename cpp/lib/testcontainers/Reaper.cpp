@@ -0,0 +1,32 @@
+#include <rust/cxx.h>
+#include <rust_tc_bridge/lib.h>
+
+#include <cstdlib>
+#include <mutex>
+
+#include "testcontainers/Reaper.hpp"
+
+namespace testcontainers {
+
+namespace {
+
+// Containers dropped after this ran are removed synchronously again
+void drain_at_exit() noexcept { ::rs_reaper_drain(); }
+
+} // namespace
+
+void Reaper::enable() {
+  static std::once_flag registered;
+  std::call_once(registered, [] { std::atexit(drain_at_exit); });
+  ::rs_reaper_set_enabled(true);
+}
+
+void Reaper::disable() noexcept { ::rs_reaper_set_enabled(false); }
+
+bool Reaper::is_enabled() noexcept { return ::rs_reaper_is_enabled(); }
+
+std::size_t Reaper::pending() noexcept { return ::rs_reaper_pending(); }
+
+void Reaper::flush() noexcept { ::rs_reaper_flush(); }
+
+} // namespace testcontainers
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+
+namespace testcontainers {
+
+/**
+ * @brief Opt-in background removal of dropped containers.
+ *
+ * By default a Container that goes out of scope removes its container before the destructor
+ * returns. Once enabled, the destructor only queues the removal and returns immediately; the
+ * removal runs on the shared runtime. What happens to the container is unchanged, reused
+ * containers are still kept.
+ *
+ * Queued removals are drained by flush() and at process exit. Container::rm() and
+ * ContainerGroup::teardown() are explicit and keep blocking.
+ *
+ * Example:
+ * @code
+ * int main(int argc, char **argv) {
+ *     testcontainers::Reaper::enable();
+ *     ::testing::InitGoogleTest(&argc, argv);
+ *     return RUN_ALL_TESTS(); // Queued removals are drained at exit
+ * }
+ * @endcode
+ */
+class Reaper final {
+public:
+  Reaper() = delete;
+
+  /// Queue the removal of containers dropped from now on.
+  static void enable();
+
+  /// Remove dropped containers in their destructor again, queued removals keep running.
+  static void disable() noexcept;
+
+  static bool is_enabled() noexcept;
+
+  /// Number of queued removals that have not finished yet.
+  static std::size_t pending() noexcept;
+
+  /**
+   * @brief Block until every removal queued so far has finished.
+   *
+   * Removal failures are not reported, same as for a container removed by its destructor.
+   */
+  static void flush() noexcept;
+};
+
+} // namespace testcontainers
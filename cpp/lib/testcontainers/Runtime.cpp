@@ -0,0 +1,14 @@
+#include <rust/cxx.h>
+#include <rust_tc_bridge/lib.h>
+
+#include "testcontainers/Runtime.hpp"
+
+#include "details/ErrorHelper.hpp"
+
+namespace testcontainers {
+
+void Runtime::configure(std::size_t worker_threads) {
+  details::call_map_error(::rs_runtime_configure, worker_threads);
+}
+
+} // namespace testcontainers
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+namespace testcontainers {
+
+/**
+ * @brief Process-wide runtime that drives all container operations.
+ *
+ * Every Container, ContainerRequest and GenericImage shares one lazily created runtime and Docker
+ * client. By default it uses one worker thread per CPU core.
+ *
+ * Example:
+ * @code
+ * int main(int argc, char **argv) {
+ *     testcontainers::Runtime::configure(4);
+ *     // ...
+ * }
+ * @endcode
+ */
+class Runtime final {
+public:
+  Runtime() = delete;
+
+  /**
+   * @brief Set the number of worker threads of the shared runtime.
+   *
+   * Must be called before the first container operation.
+   *
+   * @param worker_threads Number of worker threads, greater than zero
+   * @throws Error if worker_threads is zero or the runtime is already running
+   */
+  static void configure(std::size_t worker_threads);
+};
+
+} // namespace testcontainers
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace testcontainers {
+
+/**
+ * @brief Where the time went while a container was started, see Container::startup_profile().
+ *
+ * pull is zero when the image was already present, or when its presence could not be checked
+ * ahead of start; a pull then counts towards create. create and start are split using the
+ * timestamps reported by the Docker daemon. Conditions only this library can check, such as
+ * regex log waits, are timed one by one as they run.
+ *
+ * @note Conditions testcontainers can check run inside its start call, their timings are
+ * reconstructed from what the daemon recorded: log timestamps for log conditions, the health log
+ * for healthchecks and State.FinishedAt for exit conditions. HTTP conditions leave no such trace
+ * and share one entry, with both descriptions, with the next condition whose end is known, or
+ * take the rest of the start call when none follows. Healthchecks become such a gap too when the
+ * daemon has already dropped the passing result from its five-entry health log. The daemon is
+ * asked the first time the profile is requested; for a container restarted before that, or one
+ * reused from an earlier session, all these conditions share a single entry.
+ *
+ * Example:
+ * @code
+ * auto container = GenericImage("postgres", "16")
+ *     .with_wait_for(WaitFor::message_on_stderr("ready to accept connections"))
+ *     .start();
+ *
+ * auto profile = container.startup_profile();
+ * for (const auto &condition : profile.conditions) {
+ *   std::cout << condition.description << ": " << condition.duration.count() << "ns\n";
+ * }
+ * @endcode
+ */
+struct StartupProfile {
+  using Duration = std::chrono::duration<std::uint64_t, std::nano>;
+
+  struct Condition {
+    std::string description;
+    Duration duration{};
+  };
+
+  Duration pull{};
+  Duration create{};
+  Duration start{};
+  std::vector<Condition> conditions;
+  /// Wall time of the whole start() call, including anything not broken down above.
+  Duration total{};
+};
+
+} // namespace testcontainers
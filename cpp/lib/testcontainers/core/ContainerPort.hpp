@@ -35,6 +35,8 @@ private:
   friend class GenericImage;
   friend class ContainerRequest;
   friend class Container;
+  friend class WaitFor;
+  friend class HttpWaitStrategy;
 
   explicit ContainerPort(RsContainerPort *) noexcept;
 
@@ -4,6 +4,7 @@
 #include "testcontainers/core/CopyDataSource.hpp"
 
 #include "details/BoxHelper.hpp"
+#include "testcontainers/Error.hpp"
 #include "testcontainers/system/Path.hpp"
 
 namespace testcontainers {
@@ -25,15 +26,34 @@ CopyDataSource CopyDataSource::File(const std::filesystem::path &path) noexcept
       ::rs_copy_data_source_file(details::into_box(path_obj.rimpl_)).into_raw());
 }
 
+CopyDataSource CopyDataSource::MappedFile(const std::filesystem::path &path) noexcept {
+  Path path_obj(path);
+  return CopyDataSource(
+      ::rs_copy_data_source_mapped_file(details::into_box(path_obj.rimpl_)).into_raw());
+}
+
 CopyDataSource CopyDataSource::Data(std::vector<std::uint8_t> data) noexcept {
-  rust::Vec<std::uint8_t> rust_data;
-  rust_data.reserve(data.size());
-  for (const auto byte : data) {
-    rust_data.push_back(byte);
-  }
-  return CopyDataSource(::rs_copy_data_source_data(std::move(rust_data)).into_raw());
+  return Data(std::span<const std::uint8_t>(data));
+}
+
+CopyDataSource CopyDataSource::Data(std::span<const std::uint8_t> data) noexcept {
+  return CopyDataSource(
+      ::rs_copy_data_source_data(rust::Slice<const std::uint8_t>(data.data(), data.size()))
+          .into_raw());
+}
+
+CopyDataSource CopyDataSource::Data(std::string_view data) noexcept {
+  return Data(std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t *>(data.data()),
+                                            data.size()));
 }
 
 bool CopyDataSource::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
 
+void CopyDataSource::check_copyable_by_request() const {
+  if (rimpl_ && ::rs_copy_data_source_is_mapped_file(*rimpl_)) {
+    throw Error("with_copy_to does not accept CopyDataSource::MappedFile, use File or "
+                "Container::copy_to() once the container is started");
+  }
+}
+
 } // namespace testcontainers
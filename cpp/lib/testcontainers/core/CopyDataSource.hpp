@@ -2,6 +2,8 @@
 
 #include <filesystem>
 #include <memory>
+#include <span>
+#include <string_view>
 #include <vector>
 
 #include "testcontainers/interfaces/IRustObject.hpp"
@@ -13,7 +15,18 @@ namespace testcontainers {
 class CopyDataSource final : public IRustObject {
 public: // Static factory methods
   static CopyDataSource File(const std::filesystem::path &path) noexcept;
+  /**
+   * @brief File that is memory-mapped and streamed when copied with Container::copy_to().
+   *
+   * Only for Container::copy_to(). Requests copy their files through testcontainers before the
+   * container starts, which reads the whole file into memory, so with_copy_to() throws Error for
+   * a mapped file. Use File there, or copy_to() the mapped file once the container is running.
+   */
+  static CopyDataSource MappedFile(const std::filesystem::path &path) noexcept;
   static CopyDataSource Data(std::vector<std::uint8_t> data) noexcept;
+  /// Copies the buffer once, the caller keeps ownership.
+  static CopyDataSource Data(std::span<const std::uint8_t> data) noexcept;
+  static CopyDataSource Data(std::string_view data) noexcept;
 
 public: // Default construction methods
   CopyDataSource(CopyDataSource &&other) noexcept;
@@ -26,11 +39,15 @@ public: // IRustObject interface
   bool is_valid() const noexcept override;
 
 private:
+  friend class Container;
   friend class GenericImage;
   friend class ContainerRequest;
 
   explicit CopyDataSource(RsCopyDataSource *source) noexcept;
 
+  /// Throws for sources a request cannot copy, see MappedFile().
+  void check_copyable_by_request() const;
+
 private:
   std::unique_ptr<RsCopyDataSource, void (*)(RsCopyDataSource *)> rimpl_;
 };
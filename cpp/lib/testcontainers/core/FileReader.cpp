@@ -0,0 +1,30 @@
+#include <rust/cxx.h>
+#include <rust_tc_bridge/lib.h>
+
+#include "testcontainers/core/FileReader.hpp"
+
+#include "details/BoxHelper.hpp"
+#include "details/ErrorHelper.hpp"
+
+namespace testcontainers {
+
+FileReader::FileReader(RsFileReader *reader) noexcept
+    : rimpl_(reader,
+             [](RsFileReader *r) { ::rs_file_reader_destroy(details::box_from_raw(r)); }) {}
+
+FileReader::FileReader(FileReader &&other) noexcept = default;
+
+FileReader &FileReader::operator=(FileReader &&other) noexcept = default;
+
+FileReader::~FileReader() noexcept = default;
+
+bool FileReader::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
+
+std::size_t FileReader::read(std::span<std::uint8_t> buffer) {
+  return details::call_map_error(::rs_file_reader_read, *rimpl_,
+                                 rust::Slice<std::uint8_t>(buffer.data(), buffer.size()));
+}
+
+std::uint64_t FileReader::size() const noexcept { return ::rs_file_reader_size(*rimpl_); }
+
+} // namespace testcontainers
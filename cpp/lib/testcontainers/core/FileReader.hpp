@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "testcontainers/interfaces/IRustObject.hpp"
+
+class RsFileReader;
+
+namespace testcontainers {
+
+/**
+ * @brief Chunked reader over a single file inside a container.
+ *
+ * The file is streamed out of the container as it is read, so arbitrarily large files can be
+ * processed with a fixed-size buffer.
+ *
+ * Example:
+ * @code
+ * auto reader = container.copy_file_from("/var/log/app.log");
+ * std::array<std::uint8_t, 64 * 1024> buffer;
+ * while (auto n = reader.read(buffer)) {
+ *     sink.write(buffer.data(), n);
+ * }
+ * @endcode
+ */
+class FileReader final : public IRustObject {
+public: // Default construction methods
+  FileReader(FileReader &&other) noexcept;
+  FileReader &operator=(FileReader &&other) noexcept;
+  ~FileReader() noexcept;
+  FileReader(const FileReader &) = delete;
+  FileReader &operator=(const FileReader &) = delete;
+
+public: // IRustObject interface
+  bool is_valid() const noexcept override;
+
+public:
+  /**
+   * @brief Read up to buffer.size() bytes of the file.
+   *
+   * @return Number of bytes read, 0 once the whole file has been read.
+   * @throws Error if reading from the Docker daemon fails.
+   */
+  std::size_t read(std::span<std::uint8_t> buffer);
+
+  /// Total size of the file in bytes, as recorded in the archive header.
+  std::uint64_t size() const noexcept;
+
+private:
+  friend class Container;
+
+  explicit FileReader(RsFileReader *reader) noexcept;
+
+private:
+  std::unique_ptr<RsFileReader, void (*)(RsFileReader *)> rimpl_;
+};
+
+} // namespace testcontainers
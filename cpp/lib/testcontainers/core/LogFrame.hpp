@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string_view>
+
+namespace testcontainers {
+
+enum class LogSource : std::uint8_t {
+  Stdout = 0,
+  Stderr = 1,
+};
+
+/**
+ * @brief One chunk of container output as received from the Docker daemon.
+ *
+ * The bytes are only valid for the duration of the LogConsumer call that received them.
+ */
+struct LogFrame {
+  LogSource source;
+  std::span<const std::uint8_t> bytes;
+
+  std::string_view text() const noexcept {
+    return std::string_view(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+  }
+};
+
+/**
+ * @brief Callback receiving container output in batches of frames, in order.
+ *
+ * Invoked from a background thread, never concurrently for the same container.
+ * Exceptions thrown by the consumer are swallowed.
+ */
+using LogConsumer = std::function<void(std::span<const LogFrame> frames)>;
+
+} // namespace testcontainers
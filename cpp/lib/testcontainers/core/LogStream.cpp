@@ -0,0 +1,54 @@
+#include <rust/cxx.h>
+#include <rust_tc_bridge/lib.h>
+
+#include "testcontainers/core/LogStream.hpp"
+
+#include "details/BoxHelper.hpp"
+#include "details/ErrorHelper.hpp"
+
+namespace testcontainers {
+
+LogStream::LogStream(RsLogStream *stream) noexcept
+    : rimpl_(stream, [](RsLogStream *s) { ::rs_log_stream_destroy(details::box_from_raw(s)); }) {}
+
+LogStream::LogStream(LogStream &&other) noexcept = default;
+
+LogStream &LogStream::operator=(LogStream &&other) noexcept = default;
+
+LogStream::~LogStream() noexcept = default;
+
+bool LogStream::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
+
+std::size_t LogStream::read(std::span<std::uint8_t> buffer) {
+  return details::call_map_error(::rs_log_stream_read, *rimpl_,
+                                 rust::Slice<std::uint8_t>(buffer.data(), buffer.size()));
+}
+
+bool LogStream::read_line(std::string &line) {
+  rust::Vec<std::uint8_t> rust_line;
+  if (!details::call_map_error(::rs_log_stream_read_line, *rimpl_, rust_line)) {
+    line.clear();
+    return false;
+  }
+
+  std::size_t size = rust_line.size();
+  if (size > 0 && rust_line[size - 1] == '\n') {
+    --size;
+    if (size > 0 && rust_line[size - 1] == '\r') {
+      --size;
+    }
+  }
+  line.assign(reinterpret_cast<const char *>(rust_line.data()), size);
+  return true;
+}
+
+LogStream::LineIterator::LineIterator(LogStream *stream) : stream_(stream) { ++*this; }
+
+LogStream::LineIterator &LogStream::LineIterator::operator++() {
+  if (stream_ && !stream_->read_line(line_)) {
+    stream_ = nullptr;
+  }
+  return *this;
+}
+
+} // namespace testcontainers
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <string>
+
+#include "testcontainers/interfaces/IRustObject.hpp"
+
+class RsLogStream;
+
+namespace testcontainers {
+
+/**
+ * @brief Pull-based reader over a container's stdout or stderr.
+ *
+ * Unlike Container::stdout_to_vec(), which fetches the whole log history on every call,
+ * a LogStream reads incrementally. When following, reads block until the container
+ * produces more output and end once it stops.
+ *
+ * Example:
+ * @code
+ * auto logs = container.stdout_stream(true);
+ * for (const auto &line : logs.lines()) {
+ *     if (line.find("ready") != std::string::npos) break;
+ * }
+ * @endcode
+ */
+class LogStream final : public IRustObject {
+public: // Default construction methods
+  LogStream(LogStream &&other) noexcept;
+  LogStream &operator=(LogStream &&other) noexcept;
+  ~LogStream() noexcept;
+  LogStream(const LogStream &) = delete;
+  LogStream &operator=(const LogStream &) = delete;
+
+public: // IRustObject interface
+  bool is_valid() const noexcept override;
+
+public:
+  /**
+   * @brief Read up to buffer.size() bytes.
+   *
+   * @return Number of bytes read, 0 at the end of the stream.
+   * @throws Error if reading from the Docker daemon fails.
+   */
+  std::size_t read(std::span<std::uint8_t> buffer);
+
+  /**
+   * @brief Read the next line without its line terminator.
+   *
+   * @return false at the end of the stream.
+   * @throws Error if reading from the Docker daemon fails.
+   */
+  bool read_line(std::string &line);
+
+public: // Line iteration
+  class LineIterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::string;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string *;
+    using reference = const std::string &;
+
+    LineIterator() noexcept = default;
+    explicit LineIterator(LogStream *stream);
+
+    reference operator*() const noexcept { return line_; }
+    pointer operator->() const noexcept { return &line_; }
+    LineIterator &operator++();
+    void operator++(int) { ++*this; }
+
+    friend bool operator==(const LineIterator &lhs, const LineIterator &rhs) noexcept {
+      return lhs.stream_ == rhs.stream_;
+    }
+
+  private:
+    LogStream *stream_ = nullptr;
+    std::string line_;
+  };
+
+  class Lines {
+  public:
+    explicit Lines(LogStream &stream) noexcept : stream_(&stream) {}
+
+    LineIterator begin() const { return LineIterator(stream_); }
+    LineIterator end() const noexcept { return LineIterator(); }
+
+  private:
+    LogStream *stream_;
+  };
+
+  /// Single-pass range over the remaining lines of the stream.
+  Lines lines() noexcept { return Lines(*this); }
+
+private:
+  friend class Container;
+
+  explicit LogStream(RsLogStream *stream) noexcept;
+
+private:
+  std::unique_ptr<RsLogStream, void (*)(RsLogStream *)> rimpl_;
+};
+
+} // namespace testcontainers
@@ -0,0 +1,35 @@
+#include <rust/cxx.h>
+#include <rust_tc_bridge/lib.h>
+
+#include "testcontainers/core/ReuseDirective.hpp"
+
+#include "details/BoxHelper.hpp"
+
+namespace testcontainers {
+
+ReuseDirective::ReuseDirective(RsReuseDirective *directive) noexcept
+    : rimpl_(directive, [](RsReuseDirective *d) {
+        ::rs_reuse_directive_destroy(details::box_from_raw(d));
+      }) {}
+
+ReuseDirective::ReuseDirective(ReuseDirective &&other) noexcept = default;
+
+ReuseDirective &ReuseDirective::operator=(ReuseDirective &&other) noexcept = default;
+
+ReuseDirective::~ReuseDirective() noexcept = default;
+
+ReuseDirective ReuseDirective::Never() noexcept {
+  return ReuseDirective(::rs_reuse_directive_never().into_raw());
+}
+
+ReuseDirective ReuseDirective::Always() noexcept {
+  return ReuseDirective(::rs_reuse_directive_always().into_raw());
+}
+
+ReuseDirective ReuseDirective::CurrentSession() noexcept {
+  return ReuseDirective(::rs_reuse_directive_current_session().into_raw());
+}
+
+bool ReuseDirective::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
+
+} // namespace testcontainers
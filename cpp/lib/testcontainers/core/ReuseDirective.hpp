@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+
+#include "testcontainers/interfaces/IRustObject.hpp"
+
+class RsReuseDirective;
+
+namespace testcontainers {
+
+/**
+ * @brief Whether a started container may be attached to by later starts of the same request.
+ *
+ * Reused containers are looked up among running containers with matching name, network and
+ * labels, and are not removed when the Container goes out of scope.
+ */
+class ReuseDirective final : public IRustObject {
+public: // Static factory methods
+  /// Always start a fresh container, the default.
+  static ReuseDirective Never() noexcept;
+  /// Attach to a matching container started by any process, including earlier test runs.
+  static ReuseDirective Always() noexcept;
+  /// Attach to a matching container started within the current test session only.
+  static ReuseDirective CurrentSession() noexcept;
+
+public: // Default construction methods
+  ReuseDirective(ReuseDirective &&other) noexcept;
+  ReuseDirective &operator=(ReuseDirective &&other) noexcept;
+  ~ReuseDirective() noexcept;
+  ReuseDirective(const ReuseDirective &) = delete;
+  ReuseDirective &operator=(const ReuseDirective &) = delete;
+
+public: // IRustObject interface
+  bool is_valid() const noexcept override;
+
+private:
+  friend class GenericImage;
+  friend class ContainerRequest;
+
+  explicit ReuseDirective(RsReuseDirective *directive) noexcept;
+
+private:
+  std::unique_ptr<RsReuseDirective, void (*)(RsReuseDirective *)> rimpl_;
+};
+
+} // namespace testcontainers
@@ -4,6 +4,7 @@
 #include "testcontainers/core/SyncExecResult.hpp"
 
 #include "details/BoxHelper.hpp"
+#include "details/ErrorHelper.hpp"
 #include "details/OptionHelper.hpp"
 #include "details/VectorHelper.hpp"
 
@@ -32,16 +33,20 @@ std::vector<std::uint8_t> SyncExecResult::stderr_to_vec() noexcept {
   return utils::vec_to_vector(::rs_sync_exec_result_stderr_to_vec(*rimpl_));
 }
 
-std::string SyncExecResult::stdout_to_string() {
-  const auto out = stdout_to_vec();
-  return std::string(out.begin(), out.end());
+Bytes SyncExecResult::stdout_bytes() {
+  return Bytes(
+      details::call_map_error(::rs_sync_exec_result_stdout_bytes, *rimpl_).into_raw());
 }
 
-std::string SyncExecResult::stderr_to_string() {
-  const auto err = stderr_to_vec();
-  return std::string(err.begin(), err.end());
+Bytes SyncExecResult::stderr_bytes() {
+  return Bytes(
+      details::call_map_error(::rs_sync_exec_result_stderr_bytes, *rimpl_).into_raw());
 }
 
+std::string SyncExecResult::stdout_to_string() { return stdout_bytes().to_string(); }
+
+std::string SyncExecResult::stderr_to_string() { return stderr_bytes().to_string(); }
+
 bool SyncExecResult::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
 
 } // namespace testcontainers
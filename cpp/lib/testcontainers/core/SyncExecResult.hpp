@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "testcontainers/interfaces/IRustObject.hpp"
+#include "testcontainers/system/Bytes.hpp"
 
 class RsSyncExecResult;
 
@@ -25,6 +26,10 @@ public:
   std::vector<std::uint8_t> stdout_to_vec() noexcept;
   std::vector<std::uint8_t> stderr_to_vec() noexcept;
 
+  /// Output without the copy into a std::vector, valid as long as the returned Bytes.
+  Bytes stdout_bytes();
+  Bytes stderr_bytes();
+
   // TODO async readers
 
 public:
@@ -36,6 +41,7 @@ public: // Helper methods
 
 private:
   friend class Container;
+  template <typename T> friend class Future;
 
   explicit SyncExecResult(RsSyncExecResult *result) noexcept;
 
@@ -34,6 +34,24 @@ ExitWaitStrategy ExitWaitStrategy::with_exit_code(std::int64_t exit_code) noexce
       ::rs_exit_wait_strategy_with_exit_code(details::into_box(rimpl_), exit_code).into_raw());
 }
 
+ExitWaitStrategy ExitWaitStrategy::with_poll_backoff(
+    std::chrono::duration<std::uint64_t, std::nano> initial, double multiplier,
+    std::chrono::duration<std::uint64_t, std::nano> max) noexcept {
+  return ExitWaitStrategy(::rs_exit_wait_strategy_with_poll_backoff(
+                               details::into_box(rimpl_), initial.count(), multiplier, max.count())
+                               .into_raw());
+}
+
+ExitWaitStrategy ExitWaitStrategy::with_poll_jitter(double fraction) noexcept {
+  return ExitWaitStrategy(
+      ::rs_exit_wait_strategy_with_poll_jitter(details::into_box(rimpl_), fraction).into_raw());
+}
+
+ExitWaitStrategy ExitWaitStrategy::with_events() noexcept {
+  return ExitWaitStrategy(
+      ::rs_exit_wait_strategy_with_events(details::into_box(rimpl_)).into_raw());
+}
+
 bool ExitWaitStrategy::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
 
 } // namespace testcontainers
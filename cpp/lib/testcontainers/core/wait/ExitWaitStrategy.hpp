@@ -9,6 +9,13 @@ class RsExitWaitStrategy;
 
 namespace testcontainers {
 
+/**
+ * @brief Waits for the container to exit, optionally with a given exit code.
+ *
+ * With with_poll_backoff(), with_poll_jitter() or with_events() the wait is checked by this
+ * library instead of testcontainers, which only polls on a fixed interval. It then runs after the
+ * other ready conditions of the request have passed, whatever their order.
+ */
 class ExitWaitStrategy final : public IRustObject {
 public: // Static factory methods
   static ExitWaitStrategy exit() noexcept;
@@ -17,8 +24,25 @@ public: // Non-static factory methods that should be used in pair with static
         // factory methods
   ExitWaitStrategy with_poll_interval(std::chrono::duration<std::uint64_t, std::nano> interval) noexcept;
 
+  /**
+   * Start polling at initial and multiply the pause after each poll, never past max.
+   * Replaces with_poll_interval().
+   */
+  ExitWaitStrategy
+  with_poll_backoff(std::chrono::duration<std::uint64_t, std::nano> initial, double multiplier,
+                    std::chrono::duration<std::uint64_t, std::nano> max) noexcept;
+
+  /// Spread each pause by up to fraction of it, see HealthWaitStrategy::with_poll_jitter().
+  ExitWaitStrategy with_poll_jitter(double fraction) noexcept;
+
   ExitWaitStrategy with_exit_code(std::int64_t exit_code) noexcept;
 
+  /**
+   * Wake up on the container's die event instead of waiting for the next poll. The poll
+   * interval stays as a fallback, so it can be raised to spare the daemon inspect requests.
+   */
+  ExitWaitStrategy with_events() noexcept;
+
 public: // Default construction methods
   ExitWaitStrategy(ExitWaitStrategy &&other) noexcept;
   ExitWaitStrategy &operator=(ExitWaitStrategy &&other) noexcept;
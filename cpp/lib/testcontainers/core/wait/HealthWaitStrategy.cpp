@@ -29,6 +29,24 @@ HealthWaitStrategy HealthWaitStrategy::with_poll_interval(
           .into_raw());
 }
 
+HealthWaitStrategy HealthWaitStrategy::with_poll_backoff(
+    std::chrono::duration<std::uint64_t, std::nano> initial, double multiplier,
+    std::chrono::duration<std::uint64_t, std::nano> max) noexcept {
+  return HealthWaitStrategy(::rs_health_wait_strategy_with_poll_backoff(
+                               details::into_box(rimpl_), initial.count(), multiplier, max.count())
+                               .into_raw());
+}
+
+HealthWaitStrategy HealthWaitStrategy::with_poll_jitter(double fraction) noexcept {
+  return HealthWaitStrategy(
+      ::rs_health_wait_strategy_with_poll_jitter(details::into_box(rimpl_), fraction).into_raw());
+}
+
+HealthWaitStrategy HealthWaitStrategy::with_events() noexcept {
+  return HealthWaitStrategy(
+      ::rs_health_wait_strategy_with_events(details::into_box(rimpl_)).into_raw());
+}
+
 bool HealthWaitStrategy::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
 
 } // namespace testcontainers
@@ -9,6 +9,13 @@ class RsHealthWaitStrategy;
 
 namespace testcontainers {
 
+/**
+ * @brief Waits for the container's healthcheck to report healthy.
+ *
+ * With with_poll_backoff(), with_poll_jitter() or with_events() the wait is checked by this
+ * library instead of testcontainers, which only polls on a fixed interval. It then runs after the
+ * other ready conditions of the request have passed, whatever their order.
+ */
 class HealthWaitStrategy final : public IRustObject {
 public: // Static factory methods
   static HealthWaitStrategy healthcheck() noexcept;
@@ -17,6 +24,28 @@ public: // Non-static factory methods that should be used in pair with static
         // factory methods
   HealthWaitStrategy with_poll_interval(std::chrono::duration<std::uint64_t, std::nano> interval) noexcept;
 
+  /**
+   * Poll every initial interval at first, growing by multiplier after each poll up to max.
+   * A container that turns healthy within milliseconds is seen at once, one that needs a
+   * minute is inspected a handful of times. Replaces with_poll_interval(). Pauses are never
+   * shorter than 1ms, here and in with_poll_interval() and with_poll_jitter().
+   */
+  HealthWaitStrategy
+  with_poll_backoff(std::chrono::duration<std::uint64_t, std::nano> initial, double multiplier,
+                    std::chrono::duration<std::uint64_t, std::nano> max) noexcept;
+
+  /**
+   * Move each pause randomly by up to fraction of it (0 to 1) either way, so that containers
+   * started together do not inspect in step.
+   */
+  HealthWaitStrategy with_poll_jitter(double fraction) noexcept;
+
+  /**
+   * Wake up on the container's health_status and die events instead of waiting for the next
+   * poll. The poll interval remains the fallback for missed events.
+   */
+  HealthWaitStrategy with_events() noexcept;
+
 public: // Default construction methods
   HealthWaitStrategy(HealthWaitStrategy &&other) noexcept;
   HealthWaitStrategy &operator=(HealthWaitStrategy &&other) noexcept;
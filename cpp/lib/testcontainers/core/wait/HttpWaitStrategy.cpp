@@ -0,0 +1,61 @@
+#include <memory>
+#include <utility>
+
+#include <rust/cxx.h>
+#include <rust_tc_bridge/lib.h>
+
+#include "testcontainers/core/wait/HttpWaitStrategy.hpp"
+
+#include "details/BoxHelper.hpp"
+#include "details/HttpBodyMatcher.hpp"
+
+namespace testcontainers {
+
+HttpWaitStrategy::HttpWaitStrategy(RsHttpWaitStrategy *strategy) noexcept
+    : rimpl_(strategy, [](RsHttpWaitStrategy *s) {
+        ::rs_http_wait_strategy_destroy(details::box_from_raw(s));
+      }) {}
+
+HttpWaitStrategy::HttpWaitStrategy(HttpWaitStrategy &&other) noexcept = default;
+
+HttpWaitStrategy &HttpWaitStrategy::operator=(HttpWaitStrategy &&other) noexcept = default;
+
+HttpWaitStrategy::~HttpWaitStrategy() noexcept = default;
+
+HttpWaitStrategy HttpWaitStrategy::path(std::string_view path) {
+  return HttpWaitStrategy(::rs_http_wait_strategy_new(details::into_string(path)).into_raw());
+}
+
+HttpWaitStrategy HttpWaitStrategy::with_port(ContainerPort port) noexcept {
+  return HttpWaitStrategy(::rs_http_wait_strategy_with_port(details::into_box(rimpl_),
+                                                            details::into_box(port.rimpl_))
+                              .into_raw());
+}
+
+HttpWaitStrategy HttpWaitStrategy::with_expected_status_code(std::uint16_t status) noexcept {
+  return HttpWaitStrategy(
+      ::rs_http_wait_strategy_with_expected_status_code(details::into_box(rimpl_), status)
+          .into_raw());
+}
+
+HttpWaitStrategy HttpWaitStrategy::with_body_matcher(BodyMatcher matcher) {
+  return HttpWaitStrategy(
+      ::rs_http_wait_strategy_with_body_matcher(
+          details::into_box(rimpl_), std::make_unique<details::HttpBodyMatcher>(std::move(matcher)))
+          .into_raw());
+}
+
+HttpWaitStrategy HttpWaitStrategy::with_poll_interval(
+    std::chrono::duration<std::uint64_t, std::nano> interval) noexcept {
+  return HttpWaitStrategy(
+      ::rs_http_wait_strategy_with_poll_interval(details::into_box(rimpl_), interval.count())
+          .into_raw());
+}
+
+HttpWaitStrategy HttpWaitStrategy::with_tls() noexcept {
+  return HttpWaitStrategy(::rs_http_wait_strategy_with_tls(details::into_box(rimpl_)).into_raw());
+}
+
+bool HttpWaitStrategy::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
+
+} // namespace testcontainers
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+
+#include "testcontainers/core/ContainerPort.hpp"
+#include "testcontainers/interfaces/IRustObject.hpp"
+
+class RsHttpWaitStrategy;
+
+namespace testcontainers {
+
+/**
+ * @brief Wait strategy that polls an HTTP endpoint of the container until it answers.
+ *
+ * A response is accepted when its status is 2xx, or equals the expected status when one is
+ * set, and the body matcher (if any) returns true. A request that has not completed after two
+ * seconds is abandoned and retried on the next poll.
+ *
+ * Example:
+ * @code
+ * auto strategy = HttpWaitStrategy::path("/healthz")
+ *                     .with_port(ContainerPort::Tcp(8080))
+ *                     .with_expected_status_code(200)
+ *                     .with_body_matcher([](std::string_view body) {
+ *                       return body.find("\"status\":\"UP\"") != std::string_view::npos;
+ *                     });
+ * @endcode
+ */
+class HttpWaitStrategy final : public IRustObject {
+public:
+  /// Must be safe to call concurrently, copies of a WaitFor share one matcher.
+  using BodyMatcher = std::function<bool(std::string_view body)>;
+
+public: // Static factory methods
+  static HttpWaitStrategy path(std::string_view path);
+
+public: // Non-static factory methods that should be used in pair with static
+        // factory methods
+  /// Port to query, defaults to the first exposed port of the image.
+  HttpWaitStrategy with_port(ContainerPort port) noexcept;
+  HttpWaitStrategy with_expected_status_code(std::uint16_t status) noexcept;
+  HttpWaitStrategy with_body_matcher(BodyMatcher matcher);
+  HttpWaitStrategy
+  with_poll_interval(std::chrono::duration<std::uint64_t, std::nano> interval) noexcept;
+  HttpWaitStrategy with_tls() noexcept;
+
+public: // Default construction methods
+  HttpWaitStrategy(HttpWaitStrategy &&other) noexcept;
+  HttpWaitStrategy &operator=(HttpWaitStrategy &&other) noexcept;
+  ~HttpWaitStrategy() noexcept;
+  HttpWaitStrategy(const HttpWaitStrategy &) = delete;
+  HttpWaitStrategy &operator=(const HttpWaitStrategy &) = delete;
+
+public: // IRustObject interface
+  bool is_valid() const noexcept override;
+
+private:
+  friend class WaitFor;
+
+  explicit HttpWaitStrategy(RsHttpWaitStrategy *strategy) noexcept;
+
+private:
+  std::unique_ptr<RsHttpWaitStrategy, void (*)(RsHttpWaitStrategy *)> rimpl_;
+};
+
+} // namespace testcontainers
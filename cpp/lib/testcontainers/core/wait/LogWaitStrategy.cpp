@@ -4,6 +4,8 @@
 #include "testcontainers/core/wait/LogWaitStrategy.hpp"
 
 #include "details/BoxHelper.hpp"
+#include "details/ErrorHelper.hpp"
+#include "details/VectorHelper.hpp"
 
 namespace testcontainers {
 
@@ -30,6 +32,37 @@ LogWaitStrategy LogWaitStrategy::stdout_or_stderr(std::string_view message) {
   return LogWaitStrategy(::rs_log_wait_strategy_stdout_or_stderr(details::into_string(message)).into_raw());
 }
 
+LogWaitStrategy LogWaitStrategy::std_out_regex(std::string_view pattern) {
+  return std_out_regex_any_of({std::string(pattern)});
+}
+
+LogWaitStrategy LogWaitStrategy::std_err_regex(std::string_view pattern) {
+  return std_err_regex_any_of({std::string(pattern)});
+}
+
+LogWaitStrategy LogWaitStrategy::stdout_or_stderr_regex(std::string_view pattern) {
+  return stdout_or_stderr_regex_any_of({std::string(pattern)});
+}
+
+LogWaitStrategy LogWaitStrategy::std_out_regex_any_of(const std::vector<std::string> &patterns) {
+  return LogWaitStrategy(details::call_map_error(::rs_log_wait_strategy_stdout_regex,
+                                                 utils::vector_to_vec<rust::String>(patterns))
+                             .into_raw());
+}
+
+LogWaitStrategy LogWaitStrategy::std_err_regex_any_of(const std::vector<std::string> &patterns) {
+  return LogWaitStrategy(details::call_map_error(::rs_log_wait_strategy_stderr_regex,
+                                                 utils::vector_to_vec<rust::String>(patterns))
+                             .into_raw());
+}
+
+LogWaitStrategy
+LogWaitStrategy::stdout_or_stderr_regex_any_of(const std::vector<std::string> &patterns) {
+  return LogWaitStrategy(details::call_map_error(::rs_log_wait_strategy_stdout_or_stderr_regex,
+                                                 utils::vector_to_vec<rust::String>(patterns))
+                             .into_raw());
+}
+
 LogWaitStrategy LogWaitStrategy::with_times(std::size_t times) noexcept {
   return LogWaitStrategy(
       ::rs_log_wait_strategy_with_times(details::into_box(rimpl_), times).into_raw());
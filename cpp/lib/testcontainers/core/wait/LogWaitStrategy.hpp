@@ -1,7 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include "testcontainers/interfaces/IRustObject.hpp"
 
@@ -15,10 +17,16 @@ namespace testcontainers {
  * This class provides a fluent interface for configuring log-based wait
  * conditions.
  *
+ * The *_regex factories match log lines against regular expressions (Rust regex syntax) instead
+ * of a literal message; with several patterns a line matching any of them counts. Lines are
+ * matched as they arrive, only the current unterminated line is buffered, up to 64 KiB.
+ *
  * Example:
  * @code
  * auto strategy = LogWaitStrategy::stdout("Ready to accept connections")
  *                     .with_times(2);  // Wait for message to appear twice
+ *
+ * auto started = LogWaitStrategy::std_out_regex(R"(\[\d+\] server started in \d+ms$)");
  * @endcode
  */
 class LogWaitStrategy final : public IRustObject {
@@ -27,8 +35,17 @@ public: // Static factory methods
   static LogWaitStrategy std_err(std::string_view message);
   static LogWaitStrategy stdout_or_stderr(std::string_view message);
 
+  /// @throws Error if a pattern is not a valid regular expression or patterns is empty.
+  static LogWaitStrategy std_out_regex(std::string_view pattern);
+  static LogWaitStrategy std_err_regex(std::string_view pattern);
+  static LogWaitStrategy stdout_or_stderr_regex(std::string_view pattern);
+  static LogWaitStrategy std_out_regex_any_of(const std::vector<std::string> &patterns);
+  static LogWaitStrategy std_err_regex_any_of(const std::vector<std::string> &patterns);
+  static LogWaitStrategy stdout_or_stderr_regex_any_of(const std::vector<std::string> &patterns);
+
 public: // Non-static factory methods that should be used in pair with static
         // factory methods
+  /// For regex strategies, the number of matching lines.
   LogWaitStrategy with_times(std::size_t times) noexcept;
 
 public: // Default construction methods
@@ -4,6 +4,7 @@
 #include "testcontainers/core/wait/WaitFor.hpp"
 
 #include "details/BoxHelper.hpp"
+#include "details/ErrorHelper.hpp"
 
 namespace testcontainers {
 
@@ -36,6 +37,10 @@ WaitFor WaitFor::Exit(ExitWaitStrategy strategy) noexcept {
   return WaitFor(::rs_wait_for_exit(details::into_box(strategy.rimpl_)).into_raw());
 }
 
+WaitFor WaitFor::Http(HttpWaitStrategy strategy) noexcept {
+  return WaitFor(::rs_wait_for_http(details::into_box(strategy.rimpl_)).into_raw());
+}
+
 WaitFor WaitFor::message_on_stdout(std::string_view message) {
   return Log(LogWaitStrategy::std_out(message));
 }
@@ -58,6 +63,10 @@ WaitFor WaitFor::healthcheck() noexcept {
 
 WaitFor WaitFor::exit() noexcept { return WaitFor::Exit(ExitWaitStrategy::exit()); }
 
+WaitFor WaitFor::http(HttpWaitStrategy strategy) noexcept {
+  return WaitFor::Http(std::move(strategy));
+}
+
 WaitFor WaitFor::seconds(std::uint64_t seconds) noexcept {
   return WaitFor::Duration(std::chrono::seconds(seconds));
 }
@@ -70,6 +79,32 @@ WaitFor WaitFor::millis_in_env_var(std::string_view name) {
   return WaitFor(::rs_wait_for_millis_in_env_var(details::into_str(name)).into_raw());
 }
 
+WaitFor WaitFor::listening_port(ContainerPort port,
+                                std::chrono::duration<std::uint64_t, std::nano> timeout) {
+  return WaitFor(
+      ::rs_wait_for_listening_port(details::into_box(port.rimpl_), timeout.count()).into_raw());
+}
+
+WaitFor WaitFor::all_of(std::vector<WaitFor> conditions) {
+  rust::Vec<RsWaitFor> rust_conditions;
+  rust_conditions.reserve(conditions.size());
+  for (auto &condition : conditions) {
+    ::rs_wait_for_vec_push(rust_conditions, details::into_box(condition.rimpl_));
+  }
+  return WaitFor(
+      details::call_map_error(::rs_wait_for_all_of, std::move(rust_conditions)).into_raw());
+}
+
+WaitFor WaitFor::any_of(std::vector<WaitFor> conditions) {
+  rust::Vec<RsWaitFor> rust_conditions;
+  rust_conditions.reserve(conditions.size());
+  for (auto &condition : conditions) {
+    ::rs_wait_for_vec_push(rust_conditions, details::into_box(condition.rimpl_));
+  }
+  return WaitFor(
+      details::call_map_error(::rs_wait_for_any_of, std::move(rust_conditions)).into_raw());
+}
+
 bool WaitFor::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
 
 } // namespace testcontainers
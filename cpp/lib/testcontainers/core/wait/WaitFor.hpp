@@ -3,9 +3,12 @@
 #include <chrono>
 #include <memory>
 #include <string_view>
+#include <vector>
 
+#include "testcontainers/core/ContainerPort.hpp"
 #include "testcontainers/core/wait/ExitWaitStrategy.hpp"
 #include "testcontainers/core/wait/HealthWaitStrategy.hpp"
+#include "testcontainers/core/wait/HttpWaitStrategy.hpp"
 #include "testcontainers/core/wait/LogWaitStrategy.hpp"
 #include "testcontainers/interfaces/IRustObject.hpp"
 
@@ -20,6 +23,7 @@ public: // Static factory methods
   static WaitFor Duration(std::chrono::duration<std::uint64_t, std::nano> duration) noexcept;
   static WaitFor Healthcheck(HealthWaitStrategy strategy) noexcept;
   static WaitFor Exit(ExitWaitStrategy strategy) noexcept;
+  static WaitFor Http(HttpWaitStrategy strategy) noexcept;
 
 public: // Static factory helpers
   static WaitFor message_on_stdout(std::string_view message);
@@ -28,10 +32,47 @@ public: // Static factory helpers
   static WaitFor log(LogWaitStrategy strategy) noexcept;
   static WaitFor healthcheck() noexcept;
   static WaitFor exit() noexcept;
+  static WaitFor http(HttpWaitStrategy strategy) noexcept;
   static WaitFor seconds(std::uint64_t seconds) noexcept;
   static WaitFor millis(std::uint64_t milliseconds) noexcept;
   static WaitFor millis_in_env_var(std::string_view name);
 
+  /**
+   * @brief Wait until port is listening inside the container and reachable from the host.
+   *
+   * A TCP port is probed with a connect to its mapped host port, with exponential backoff (10ms
+   * doubling up to 500ms). Once the connect succeeds, the port must also show up in the socket
+   * tables of the container, checked by an exec of sh with a fallback to nc or bash, since a
+   * connect alone may only reach the Docker userland proxy. In images where that exec cannot run,
+   * such as distroless or scratch images, the connect decides alone; UDP and SCTP ports are then
+   * not checked at all. Fails the start with Error when the port is not listening within timeout.
+   *
+   * @note The check runs after the other ready conditions of the request have passed.
+   */
+  static WaitFor listening_port(ContainerPort port,
+                                std::chrono::duration<std::uint64_t, std::nano> timeout);
+
+public: // Composite conditions
+  /**
+   * @brief Ready once every condition holds.
+   *
+   * The conditions are checked concurrently, so the wait takes as long as the slowest one
+   * rather than the sum of all of them. Like listening_port(), the check runs after the other
+   * ready conditions of the request have passed.
+   *
+   * @throws Error if a condition cannot be checked concurrently (an HTTPS wait).
+   */
+  static WaitFor all_of(std::vector<WaitFor> conditions);
+
+  /**
+   * @brief Ready as soon as one of the conditions holds, the others are abandoned.
+   *
+   * Fails only when every condition has failed.
+   *
+   * @throws Error if conditions is empty or a condition cannot be checked concurrently.
+   */
+  static WaitFor any_of(std::vector<WaitFor> conditions);
+
 public: // Default construction methods
   WaitFor(WaitFor &&other) noexcept;
   WaitFor &operator=(WaitFor &&other) noexcept;
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "testcontainers/Future.hpp"
+
+namespace testcontainers {
+
+class Container;
+class ContainerRequest;
+
+class IAsyncRunner {
+public:
+  virtual ~IAsyncRunner() = default;
+
+  virtual Future<Container> start_async() = 0;
+  virtual Future<ContainerRequest> pull_async() = 0;
+};
+
+} // namespace testcontainers
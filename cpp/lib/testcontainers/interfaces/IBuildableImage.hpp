@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
+#include <span>
+#include <string_view>
 #include <vector>
 
 namespace testcontainers {
@@ -15,6 +18,8 @@ public:
   virtual GenericBuildableImage with_dockerfile_string(std::string_view content) = 0;
   virtual GenericBuildableImage with_file(const std::filesystem::path &source, std::string_view target) = 0;
   virtual GenericBuildableImage with_data(const std::vector<std::uint8_t> &data, std::string_view target) = 0;
+  virtual GenericBuildableImage with_data(std::span<const std::uint8_t> data, std::string_view target) = 0;
+  virtual GenericBuildableImage with_data(std::string_view data, std::string_view target) = 0;
 };
 
 } // namespace testcontainers
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace testcontainers {
+
+template <typename T> class ICloneable {
+public:
+  virtual ~ICloneable() = default;
+
+  virtual T clone() const = 0;
+};
+
+} // namespace testcontainers
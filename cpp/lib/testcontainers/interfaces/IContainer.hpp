@@ -2,12 +2,14 @@
 
 #include <cstdint>
 #include <optional>
+#include <string>
 #include <vector>
 
 namespace testcontainers {
 
 class ContainerPort;
 class ExecCommand;
+class LogStream;
 class SyncExecResult;
 class UrlHost;
 
@@ -15,6 +17,7 @@ class IContainer {
 public:
   virtual ~IContainer() = default;
 
+  virtual std::string id() const = 0;
   virtual std::uint16_t get_host_port_ipv4(ContainerPort port) const = 0;
   virtual std::uint16_t get_host_port_ipv6(ContainerPort port) const = 0;
   virtual UrlHost get_host() const = 0;
@@ -24,6 +27,8 @@ public:
   virtual void start() const = 0;
   virtual std::vector<std::uint8_t> stdout_to_vec() const = 0;
   virtual std::vector<std::uint8_t> stderr_to_vec() const = 0;
+  virtual LogStream stdout_stream(bool follow) const = 0;
+  virtual LogStream stderr_stream(bool follow) const = 0;
   virtual bool is_running() const = 0;
   virtual std::optional<std::int64_t> exit_code() const = 0;
 };
@@ -7,6 +7,8 @@
 #include <utility>
 #include <vector>
 
+#include "testcontainers/core/LogFrame.hpp"
+
 namespace testcontainers {
 
 class ContainerPort;
@@ -15,6 +17,7 @@ class CopyDataSource;
 class Healthcheck;
 class Host;
 class Mount;
+class ReuseDirective;
 class WaitFor;
 class CgroupnsMode;
 
@@ -34,6 +37,7 @@ public:
   virtual ContainerRequest with_host(std::string_view key, Host host) = 0;
   virtual ContainerRequest with_hostname(std::string_view hostname) = 0;
   virtual ContainerRequest with_mount(Mount mount) noexcept = 0;
+  /// @throws Error for a CopyDataSource::MappedFile, see there.
   virtual ContainerRequest with_copy_to(std::string_view target, CopyDataSource source) = 0;
   virtual ContainerRequest with_mapped_port(std::uint16_t host_port,
                                             ContainerPort container_port) noexcept
@@ -53,8 +57,13 @@ public:
   with_startup_timeout(std::chrono::duration<std::uint64_t, std::nano> timeout) noexcept
       = 0;
   virtual ContainerRequest with_working_dir(std::string_view working_dir) = 0;
-  // with_log_consumer (TODO.md)
-  // with_reuse (#[cfg(feature = "reusable-containers")])
+  virtual ContainerRequest with_log_consumer(LogConsumer consumer) = 0;
+  virtual ContainerRequest with_reuse(ReuseDirective reuse) = 0;
+  /**
+   * Reuse a running container across processes, matched by key. An empty key derives one from
+   * the request itself, see ContainerRequest::spec_key().
+   */
+  virtual ContainerRequest with_reuse_key(std::string_view key = {}) = 0;
   virtual ContainerRequest with_user(std::string_view user) = 0;
   virtual ContainerRequest with_readonly_rootfs(bool readonly_rootfs) noexcept = 0;
   virtual ContainerRequest with_security_opt(std::string_view security_opt) = 0;
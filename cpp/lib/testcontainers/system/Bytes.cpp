@@ -0,0 +1,43 @@
+#include <utility>
+
+#include <rust/cxx.h>
+#include <rust_tc_bridge/lib.h>
+
+#include "testcontainers/system/Bytes.hpp"
+
+#include "details/BoxHelper.hpp"
+
+namespace testcontainers {
+
+Bytes::Bytes(RsBytes *bytes) noexcept
+    : rimpl_(bytes, [](RsBytes *b) { ::rs_bytes_destroy(details::box_from_raw(b)); }) {
+  if (rimpl_) {
+    const auto slice = rimpl_->rs_bytes_as_slice();
+    span_ = std::span<const std::uint8_t>(slice.data(), slice.size());
+  }
+}
+
+Bytes::Bytes(Bytes &&other) noexcept
+    : rimpl_(std::move(other.rimpl_)), span_(std::exchange(other.span_, {})) {}
+
+Bytes &Bytes::operator=(Bytes &&other) noexcept {
+  rimpl_ = std::move(other.rimpl_);
+  span_ = std::exchange(other.span_, {});
+  return *this;
+}
+
+Bytes::~Bytes() noexcept = default;
+
+bool Bytes::is_valid() const noexcept { return static_cast<bool>(rimpl_); }
+
+std::string_view Bytes::view() const noexcept {
+  return std::string_view(reinterpret_cast<const char *>(span_.data()), span_.size());
+}
+
+std::string Bytes::to_string() const { return std::string(view()); }
+
+std::vector<std::uint8_t> Bytes::to_vector() const {
+  return std::vector<std::uint8_t>(span_.begin(), span_.end());
+}
+
+} // namespace testcontainers
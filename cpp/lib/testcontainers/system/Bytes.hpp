@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "testcontainers/interfaces/IRustObject.hpp"
+
+class RsBytes;
+
+namespace testcontainers {
+
+/**
+ * @brief Immutable byte buffer owned by the Rust side.
+ *
+ * Views into the buffer are handed out without copying and stay valid as long as the
+ * Bytes object is alive.
+ */
+class Bytes final : public IRustObject {
+public: // Default construction methods
+  Bytes(Bytes &&other) noexcept;
+  Bytes &operator=(Bytes &&other) noexcept;
+  ~Bytes() noexcept;
+  Bytes(const Bytes &) = delete;
+  Bytes &operator=(const Bytes &) = delete;
+
+public: // IRustObject interface
+  bool is_valid() const noexcept override;
+
+public: // Views
+  std::span<const std::uint8_t> span() const noexcept { return span_; }
+  std::string_view view() const noexcept;
+
+  const std::uint8_t *data() const noexcept { return span_.data(); }
+  std::size_t size() const noexcept { return span_.size(); }
+  bool empty() const noexcept { return span_.empty(); }
+  const std::uint8_t *begin() const noexcept { return data(); }
+  const std::uint8_t *end() const noexcept { return data() + size(); }
+
+public: // Copies
+  std::string to_string() const;
+  std::vector<std::uint8_t> to_vector() const;
+
+private:
+  friend class Container;
+  friend class SyncExecResult;
+
+  explicit Bytes(RsBytes *bytes) noexcept;
+
+private:
+  std::unique_ptr<RsBytes, void (*)(RsBytes *)> rimpl_;
+  // Fetched once, the Rust buffer never moves while rimpl_ owns it
+  std::span<const std::uint8_t> span_;
+};
+
+} // namespace testcontainers
@@ -27,6 +27,7 @@ public:
   std::optional<std::string> to_string() const;
 
 private:
+  friend class Container;
   friend class CopyDataSource;
   friend class GenericBuildableImage;
 
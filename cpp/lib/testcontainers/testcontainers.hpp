@@ -1,12 +1,17 @@
 #include "testcontainers/core/ContainerPort.hpp"
 #include "testcontainers/core/Host.hpp"
 #include "testcontainers/core/Mount.hpp"
+#include "testcontainers/core/ReuseDirective.hpp"
 #include "testcontainers/core/CgroupnsMode.hpp"
 #include "testcontainers/core/CopyDataSource.hpp"
 #include "testcontainers/core/Healthcheck.hpp"
 #include "testcontainers/core/ExecCommand.hpp"
+#include "testcontainers/core/FileReader.hpp"
+#include "testcontainers/core/LogFrame.hpp"
+#include "testcontainers/core/LogStream.hpp"
 #include "testcontainers/core/SyncExecResult.hpp"
 #include "testcontainers/core/wait/WaitFor.hpp"
+#include "testcontainers/system/Bytes.hpp"
 #include "testcontainers/system/UrlHost.hpp"
 #include "testcontainers/system/Path.hpp"
 #include "testcontainers/system/ip/IpAddr.hpp"
@@ -15,8 +20,15 @@
 
 #include "testcontainers/Error.hpp"
 #include "testcontainers/Container.hpp"
+#include "testcontainers/ContainerGroup.hpp"
+#include "testcontainers/ContainerPool.hpp"
+#include "testcontainers/Future.hpp"
 #include "testcontainers/ContainerRequest.hpp"
+#include "testcontainers/ContainerSpec.hpp"
 #include "testcontainers/GenericBuildableImage.hpp"
 #include "testcontainers/GenericImage.hpp"
+#include "testcontainers/Reaper.hpp"
+#include "testcontainers/Runtime.hpp"
+#include "testcontainers/StartupProfile.hpp"
 #include "testcontainers/Version.hpp"
 
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <functional>
+#include <utility>
+
+namespace testcontainers::details {
+
+// Completion callback handed to the Rust runtime, invoked once on a runtime thread.
+// Kept header-only so the bridge can call it without linking back to the C++ library.
+class AsyncWaker final {
+public:
+  explicit AsyncWaker(std::function<void()> callback) noexcept : callback_(std::move(callback)) {}
+
+  void wake() const { callback_(); }
+
+private:
+  std::function<void()> callback_;
+};
+
+} // namespace testcontainers::details
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <utility>
+
+#include <rust/cxx.h>
+
+namespace testcontainers::details {
+
+// Checks the body of a readiness response. Called from runtime worker threads, possibly from
+// several at once when the owning WaitFor was copied into more than one request.
+class HttpBodyMatcher final {
+public:
+  using Matcher = std::function<bool(std::string_view body)>;
+
+  explicit HttpBodyMatcher(Matcher matcher) noexcept : matcher_(std::move(matcher)) {}
+
+  bool matches(rust::Slice<const std::uint8_t> body) const {
+    return matcher_(std::string_view(reinterpret_cast<const char *>(body.data()), body.size()));
+  }
+
+private:
+  Matcher matcher_;
+};
+
+} // namespace testcontainers::details
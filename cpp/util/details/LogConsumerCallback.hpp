@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include <rust/cxx.h>
+
+namespace testcontainers::details {
+
+// Receives a batch of log frames from the Rust runtime, one call at a time.
+// Frame i spans data[ends[i - 1], ends[i]) and comes from stderr when sources[i] is 1.
+class LogConsumerCallback final {
+public:
+  using Callback = std::function<void(rust::Slice<const std::uint8_t> data,
+                                      rust::Slice<const std::size_t> ends,
+                                      rust::Slice<const std::uint8_t> sources)>;
+
+  explicit LogConsumerCallback(Callback callback) noexcept : callback_(std::move(callback)) {}
+
+  void consume(rust::Slice<const std::uint8_t> data, rust::Slice<const std::size_t> ends,
+               rust::Slice<const std::uint8_t> sources) const {
+    callback_(data, ends, sources);
+  }
+
+private:
+  Callback callback_;
+};
+
+} // namespace testcontainers::details
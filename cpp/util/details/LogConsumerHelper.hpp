@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <rust/cxx.h>
+
+#include "details/LogConsumerCallback.hpp"
+#include "testcontainers/core/LogFrame.hpp"
+
+namespace testcontainers::details {
+
+// Adapts a user LogConsumer to the flat batch layout delivered by the bridge.
+inline std::unique_ptr<LogConsumerCallback> make_log_consumer_callback(LogConsumer consumer) {
+  return std::make_unique<LogConsumerCallback>(
+      [consumer = std::move(consumer), frames = std::vector<LogFrame>()](
+          rust::Slice<const std::uint8_t> data, rust::Slice<const std::size_t> ends,
+          rust::Slice<const std::uint8_t> sources) mutable {
+        frames.clear();
+        frames.reserve(ends.size());
+        std::size_t begin = 0;
+        for (std::size_t i = 0; i < ends.size(); ++i) {
+          frames.push_back(LogFrame{static_cast<LogSource>(sources[i]),
+                                    std::span<const std::uint8_t>(data.data() + begin,
+                                                                  ends[i] - begin)});
+          begin = ends[i];
+        }
+        consumer(std::span<const LogFrame>(frames.data(), frames.size()));
+      });
+}
+
+} // namespace testcontainers::details
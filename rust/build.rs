@@ -6,7 +6,7 @@ fn main() {
 
     let mut build = cxx_build::bridge("src/lib.rs");
 
-    build.cpp(true).std(std);
+    build.cpp(true).std(std).include("../cpp/util");
 
     if let Some(pic) = pic_opt {
         build.pic(pic);
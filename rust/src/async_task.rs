@@ -0,0 +1,118 @@
+use crate::{
+    container::RsContainer, container_request::RsContainerRequest,
+    core::exec::sync_exec_result::RsSyncExecResult, ffi::AsyncWaker, runtime::runtime,
+};
+use cxx::UniquePtr;
+use std::{future::Future, time::Duration};
+use tokio::{sync::watch, task::JoinHandle};
+
+// The waker owns a std::function that is only invoked once, from a single thread
+unsafe impl Send for AsyncWaker {}
+
+pub enum RsAsyncOutput {
+    Unit,
+    Container(RsContainer),
+    ContainerRequest(RsContainerRequest),
+    ExecResult(RsSyncExecResult),
+}
+
+/// Operation running on the shared runtime.
+/// Dropping it detaches the operation; its output is dropped on completion.
+pub struct RsAsyncTask {
+    handle: JoinHandle<Result<RsAsyncOutput, String>>,
+    done: watch::Receiver<bool>,
+}
+
+pub fn rs_async_task_into_unit(task: Box<RsAsyncTask>) -> Result<(), String> {
+    match join(task)? {
+        RsAsyncOutput::Unit => Ok(()),
+        _ => Err("Async task did not produce a unit".to_string()),
+    }
+}
+
+pub fn rs_async_task_into_container(task: Box<RsAsyncTask>) -> Result<Box<RsContainer>, String> {
+    match join(task)? {
+        RsAsyncOutput::Container(container) => Ok(Box::new(container)),
+        _ => Err("Async task did not produce a container".to_string()),
+    }
+}
+
+pub fn rs_async_task_into_container_request(
+    task: Box<RsAsyncTask>,
+) -> Result<Box<RsContainerRequest>, String> {
+    match join(task)? {
+        RsAsyncOutput::ContainerRequest(container_request) => Ok(Box::new(container_request)),
+        _ => Err("Async task did not produce a container request".to_string()),
+    }
+}
+
+pub fn rs_async_task_into_exec_result(
+    task: Box<RsAsyncTask>,
+) -> Result<Box<RsSyncExecResult>, String> {
+    match join(task)? {
+        RsAsyncOutput::ExecResult(exec_result) => Ok(Box::new(exec_result)),
+        _ => Err("Async task did not produce an exec result".to_string()),
+    }
+}
+
+pub fn rs_async_task_destroy(task: Box<RsAsyncTask>) {
+    drop(task);
+}
+
+fn join(task: Box<RsAsyncTask>) -> Result<RsAsyncOutput, String> {
+    runtime()
+        .block_on(task.handle)
+        .map_err(|e| format!("Async task failed: {}", e))?
+}
+
+impl RsAsyncTask {
+    pub fn spawn<F>(future: F) -> Box<RsAsyncTask>
+    where
+        F: Future<Output = Result<RsAsyncOutput, String>> + Send + 'static,
+    {
+        let (done_tx, done) = watch::channel(false);
+        let handle = runtime().spawn(async move {
+            let output = future.await;
+            let _ = done_tx.send(true);
+            output
+        });
+        Box::new(RsAsyncTask { handle, done })
+    }
+
+    pub fn rs_async_task_is_ready(self: &RsAsyncTask) -> bool {
+        *self.done.borrow() || self.handle.is_finished()
+    }
+
+    pub fn rs_async_task_wait(self: &RsAsyncTask) {
+        let mut done = self.done.clone();
+        // Err means the sender is gone, i.e. the task has ended anyway
+        let _ = runtime().block_on(done.wait_for(|ready| *ready));
+    }
+
+    pub fn rs_async_task_wait_for(self: &RsAsyncTask, timeout_ns: u64) -> bool {
+        let mut done = self.done.clone();
+        runtime().block_on(async move {
+            tokio::time::timeout(
+                Duration::from_nanos(timeout_ns),
+                done.wait_for(|ready| *ready),
+            )
+            .await
+            .is_ok()
+        })
+    }
+
+    /// Calls `waker` once the task has completed. The call runs on the blocking pool,
+    /// so the callback is free to issue blocking bridge calls.
+    pub fn rs_async_task_on_ready(self: &RsAsyncTask, waker: UniquePtr<AsyncWaker>) {
+        let mut done = self.done.clone();
+        runtime().spawn(async move {
+            // Err means the sender is gone, i.e. the task has ended anyway
+            let _ = done.wait_for(|ready| *ready).await;
+            let _ = tokio::task::spawn_blocking(move || {
+                if let Some(waker) = waker.as_ref() {
+                    waker.wake();
+                }
+            });
+        });
+    }
+}
@@ -1,5 +1,5 @@
-use crate::{image::RsGenericImage, system::path::RsPath};
-use testcontainers::{runners::SyncBuilder, GenericBuildableImage};
+use crate::{image::RsGenericImage, runtime::runtime, system::path::RsPath};
+use testcontainers::{runners::AsyncBuilder, GenericBuildableImage};
 
 pub struct RsGenericBuildableImage {
     pub image: GenericBuildableImage,
@@ -41,20 +41,19 @@ pub fn rs_generic_buildable_image_with_file(
 
 pub fn rs_generic_buildable_image_with_data(
     image: Box<RsGenericBuildableImage>,
-    data: Vec<u8>,
+    data: &[u8],
     target: String,
 ) -> Box<RsGenericBuildableImage> {
     Box::new(RsGenericBuildableImage::new(
-        image.image.with_data(data, target),
+        image.image.with_data(data.to_vec(), target),
     ))
 }
 
 pub fn rs_generic_buildable_image_build(
     image: Box<RsGenericBuildableImage>,
 ) -> Result<Box<RsGenericImage>, String> {
-    let built_image = image
-        .image
-        .build_image()
+    let built_image = runtime()
+        .block_on(image.image.build_image())
         .map_err(|e| format!("Failed to build image: {}", e))?;
     Ok(Box::new(RsGenericImage::new(built_image)))
 }
@@ -1,28 +1,104 @@
 use crate::{
+    async_task::{RsAsyncOutput, RsAsyncTask},
+    core::container_port::RsContainerPort, core::copy_data_source::RsCopyDataSource,
     core::exec::exec_command::RsExecCommand, core::exec::sync_exec_result::RsSyncExecResult,
-    image::RsGenericImage, system::ip::ip_addr::RsIpAddr, system::url_host::RsUrlHost,
-    core::container_port::RsContainerPort,
+    core::file_reader::RsFileReader, core::log_stream::RsLogStream,
+    core::startup_profile::StartupTimeline, ffi::RsStartupProfile, image::RsGenericImage, reaper,
+    runtime::runtime, system::bytes::RsBytes, system::ip::ip_addr::RsIpAddr,
+    system::path::RsPath, system::url_host::RsUrlHost,
 };
-use testcontainers::{core::ContainerPort, Container, GenericImage};
+use std::sync::Arc;
+use testcontainers::{core::ContainerPort, ContainerAsync, GenericImage};
 
 pub struct RsContainer {
-    container: Container<GenericImage>,
+    // Shared with pending async operations, the container is removed when the last one is dropped
+    container: Arc<ContainerAsync<GenericImage>>,
+    timeline: Option<StartupTimeline>,
+    // Started with a reuse directive, dropping it leaves the container running
+    reusable: bool,
 }
 
 pub fn rs_container_destroy(container: Box<RsContainer>) {
+    let Some(container) = reaper::defer_drop(container) else {
+        return;
+    };
+    // ContainerAsync removes the container on drop using the current runtime
+    let _guard = runtime().enter();
     drop(container);
 }
 
 pub fn rs_container_rm(container: Box<RsContainer>) -> Result<(), String> {
-    container
-        .container
-        .rm()
+    let _guard = runtime().enter();
+    let container = Arc::try_unwrap(container.container).map_err(|_| {
+        "Failed to remove container: container is used by pending async operations".to_string()
+    })?;
+    runtime()
+        .block_on(container.rm())
         .map_err(|e| format!("Failed to remove container: {}", e))
 }
 
+// vec helpers
+pub fn rs_container_vec_push(vec: &mut Vec<RsContainer>, container: Box<RsContainer>) {
+    vec.push(*container);
+}
+
+/// Stops and removes every container at once, instead of one drop after the other.
+/// Every container is torn down even when some fail; the errors are joined.
+pub fn rs_container_teardown_all(
+    containers: Vec<RsContainer>,
+    stop_timeout_sec_opt: Vec<i32>,
+) -> Result<(), String> {
+    let runtime = runtime();
+    let stop_timeout = stop_timeout_sec_opt.first().copied();
+    let handles: Vec<_> = containers
+        .into_iter()
+        .map(|container| runtime.spawn(container.teardown(stop_timeout)))
+        .collect();
+    runtime.block_on(async move {
+        let mut errors = Vec::new();
+        for handle in handles {
+            match handle.await {
+                Ok(Ok(())) => {}
+                Ok(Err(e)) => errors.push(e),
+                Err(e) => errors.push(format!("Failed to remove container: {}", e)),
+            }
+        }
+        if errors.is_empty() {
+            Ok(())
+        } else {
+            Err(errors.join("; "))
+        }
+    })
+}
+
 impl RsContainer {
-    pub fn new(container: Container<GenericImage>) -> Self {
-        Self { container }
+    async fn teardown(self, stop_timeout: Option<i32>) -> Result<(), String> {
+        // Like a drop, which declines to remove containers marked for reuse
+        if self.reusable {
+            return Ok(());
+        }
+        // A failed stop is not reported: the forced removal below kills the container anyway
+        let _ = self.container.stop_with_timeout(stop_timeout).await;
+        match Arc::try_unwrap(self.container) {
+            Ok(container) => container
+                .rm()
+                .await
+                .map_err(|e| format!("Failed to remove container: {}", e)),
+            // Pending async operations keep it alive, the last one to finish removes it
+            Err(_) => Ok(()),
+        }
+    }
+
+    pub fn started(
+        container: ContainerAsync<GenericImage>,
+        timeline: StartupTimeline,
+        reusable: bool,
+    ) -> Self {
+        Self {
+            container: Arc::new(container),
+            timeline: Some(timeline),
+            reusable,
+        }
     }
 
     pub fn rs_container_id(self: &RsContainer) -> &str {
@@ -41,8 +117,8 @@ impl RsContainer {
         port: Box<RsContainerPort>,
     ) -> Result<u16, String> {
         let port: ContainerPort = (*port).into();
-        self.container
-            .get_host_port_ipv4(port)
+        runtime()
+            .block_on(self.container.get_host_port_ipv4(port))
             .map_err(|e| format!("Failed to get host port: {}", e))
     }
 
@@ -51,21 +127,21 @@ impl RsContainer {
         port: Box<RsContainerPort>,
     ) -> Result<u16, String> {
         let port: ContainerPort = (*port).into();
-        self.container
-            .get_host_port_ipv6(port)
+        runtime()
+            .block_on(self.container.get_host_port_ipv6(port))
             .map_err(|e| format!("Failed to get host port: {}", e))
     }
 
     pub fn rs_container_get_bridge_ip_address(self: &RsContainer) -> Result<Box<RsIpAddr>, String> {
-        self.container
-            .get_bridge_ip_address()
+        runtime()
+            .block_on(self.container.get_bridge_ip_address())
             .map_err(|e| format!("Failed to get bridge IP address: {}", e))
             .map(|ip_addr| Box::new(RsIpAddr::new(ip_addr)))
     }
 
     pub fn rs_container_get_host(self: &RsContainer) -> Result<Box<RsUrlHost>, String> {
-        self.container
-            .get_host()
+        runtime()
+            .block_on(self.container.get_host())
             .map_err(|e| format!("Failed to get host: {}", e))
             .map(|host| Box::new(RsUrlHost::new(host)))
     }
@@ -74,30 +150,82 @@ impl RsContainer {
         self: &RsContainer,
         cmd: Box<RsExecCommand>,
     ) -> Result<Box<RsSyncExecResult>, String> {
-        self.container
-            .exec(cmd.command)
-            .map_err(|e| format!("Failed to exec command: {}", e))
+        runtime()
+            .block_on(cmd.run(&self.container))
             .map(|exec_result| Box::new(RsSyncExecResult::new(exec_result)))
     }
 
+    pub fn rs_container_exec_async(
+        self: &RsContainer,
+        cmd: Box<RsExecCommand>,
+    ) -> Box<RsAsyncTask> {
+        let container = self.container.clone();
+        RsAsyncTask::spawn(async move {
+            cmd.run(&container)
+                .await
+                .map(|exec_result| RsAsyncOutput::ExecResult(RsSyncExecResult::new(exec_result)))
+        })
+    }
+
+    pub fn rs_container_copy_to(
+        self: &RsContainer,
+        target: &str,
+        source: Box<RsCopyDataSource>,
+    ) -> Result<(), String> {
+        runtime().block_on(source.upload(self.container.id(), target))
+    }
+
+    pub fn rs_container_copy_file_from(
+        self: &RsContainer,
+        path: &str,
+    ) -> Result<Box<RsFileReader>, String> {
+        runtime()
+            .block_on(RsFileReader::open(self.container.id(), path))
+            .map(Box::new)
+    }
+
+    pub fn rs_container_copy_to_host(
+        self: &RsContainer,
+        path: &str,
+        host_path: Box<RsPath>,
+    ) -> Result<(), String> {
+        runtime().block_on(async {
+            RsFileReader::open(self.container.id(), path)
+                .await?
+                .copy_to_host(&host_path.path)
+                .await
+        })
+    }
+
     pub fn rs_container_stop(self: &RsContainer) -> Result<(), String> {
-        self.container
-            .stop()
+        runtime()
+            .block_on(self.container.stop())
             .map_err(|e| format!("Failed to stop container: {}", e))
     }
 
+    pub fn rs_container_stop_async(self: &RsContainer) -> Box<RsAsyncTask> {
+        let container = self.container.clone();
+        RsAsyncTask::spawn(async move {
+            container
+                .stop()
+                .await
+                .map_err(|e| format!("Failed to stop container: {}", e))
+                .map(|_| RsAsyncOutput::Unit)
+        })
+    }
+
     pub fn rs_container_stop_with_timeout(
         self: &RsContainer,
         timeout_sec_opt: Vec<i32>,
     ) -> Result<(), String> {
-        self.container
-            .stop_with_timeout(timeout_sec_opt.first().copied())
+        runtime()
+            .block_on(self.container.stop_with_timeout(timeout_sec_opt.first().copied()))
             .map_err(|e| format!("Failed to stop container with timeout: {}", e))
     }
 
     pub fn rs_container_start(self: &RsContainer) -> Result<(), String> {
-        self.container
-            .start()
+        runtime()
+            .block_on(self.container.start())
             .map_err(|e| format!("Failed to start container: {}", e))
     }
 
@@ -105,36 +233,56 @@ impl RsContainer {
     // pub async fn rs_container_pause(self: &RsContainer) -> Result<(), String>
     // pub async fn rs_container_unpause(self: &RsContainer) -> Result<(), String>
 
-    // TODO callbacks
-    // pub fn stdout(&self, follow: bool) -> Box<dyn BufRead + Send>
-    // pub fn stderr(&self, follow: bool) -> Box<dyn BufRead + Send>
+    pub fn rs_container_stdout(self: &RsContainer, follow: bool) -> Box<RsLogStream> {
+        let _guard = runtime().enter();
+        Box::new(RsLogStream::new(self.container.stdout(follow)))
+    }
+
+    pub fn rs_container_stderr(self: &RsContainer, follow: bool) -> Box<RsLogStream> {
+        let _guard = runtime().enter();
+        Box::new(RsLogStream::new(self.container.stderr(follow)))
+    }
 
     pub fn rs_container_stdout_to_vec(self: &RsContainer) -> Result<Vec<u8>, String> {
-        self.container
-            .stdout_to_vec()
+        runtime()
+            .block_on(self.container.stdout_to_vec())
             .map_err(|e| format!("Failed to get stdout: {}", e))
     }
 
     pub fn rs_container_stderr_to_vec(self: &RsContainer) -> Result<Vec<u8>, String> {
-        self.container
-            .stderr_to_vec()
+        runtime()
+            .block_on(self.container.stderr_to_vec())
             .map_err(|e| format!("Failed to get stderr: {}", e))
     }
 
+    pub fn rs_container_stdout_bytes(self: &RsContainer) -> Result<Box<RsBytes>, String> {
+        self.rs_container_stdout_to_vec()
+            .map(|bytes| Box::new(RsBytes::new(bytes)))
+    }
+
+    pub fn rs_container_stderr_bytes(self: &RsContainer) -> Result<Box<RsBytes>, String> {
+        self.rs_container_stderr_to_vec()
+            .map(|bytes| Box::new(RsBytes::new(bytes)))
+    }
+
+    pub fn rs_container_startup_profile(self: &RsContainer) -> Result<RsStartupProfile, String> {
+        let timeline = self
+            .timeline
+            .as_ref()
+            .ok_or_else(|| "No startup profile was recorded for this container".to_string())?;
+        runtime().block_on(timeline.profile(self.container.id()))
+    }
+
     pub fn rs_container_is_running(self: &RsContainer) -> Result<bool, String> {
-        self.container
-            .is_running()
+        runtime()
+            .block_on(self.container.is_running())
             .map_err(|e| format!("Failed to get is running: {}", e))
     }
 
     pub fn rs_container_exit_code_opt(self: &RsContainer) -> Result<Vec<i64>, String> {
-        self.container
-            .exit_code()
+        runtime()
+            .block_on(self.container.exit_code())
             .map_err(|e| format!("Failed to get exit code: {}", e))
             .map(|opt| opt.into_iter().collect())
     }
-
-    // TODO async
-    // fn rt(&self) -> &Arc<tokio::runtime::Runtime>
-    // fn async_impl(&self) -> &ContainerAsync<I>
 }
@@ -1,14 +1,34 @@
 use crate::{
+    async_task::{RsAsyncOutput, RsAsyncTask},
     container::RsContainer, core::cgroupns_mode::RsCgroupnsMode,
     core::container_port::RsContainerPort, core::copy_data_source::RsCopyDataSource,
-    core::healthcheck::RsHealthcheck, core::host::RsHost, core::mount::RsMount,
-    core::wait::wait_for::RsWaitFor,
+    core::healthcheck::RsHealthcheck, core::host::RsHost, core::log_consumer::RsLogConsumer,
+    core::mount::RsMount, core::reuse_directive::RsReuseDirective,
+    core::startup_profile::StartupTimeline, core::wait::native_wait,
+    core::wait::wait_for::{upstream_conditions, RsWaitFor}, docker::docker,
+    ffi::LogConsumerCallback, runtime::runtime, system::digest::StableHasher,
 };
-use std::time::Duration;
-use testcontainers::{runners::SyncRunner, ContainerRequest, GenericImage, ImageExt};
+use cxx::UniquePtr;
+use std::collections::{BTreeMap, BTreeSet};
+use std::sync::Mutex;
+use std::time::{Duration, Instant, SystemTime};
+use testcontainers::{
+    core::ReuseDirective, runners::AsyncRunner, ContainerRequest, GenericImage, ImageExt,
+};
+
+// Images known to the daemon, so the pull check of pull_if_missing is paid once per image
+static PRESENT_IMAGES: Mutex<BTreeSet<String>> = Mutex::new(BTreeSet::new());
 
 pub struct RsContainerRequest {
     pub container: ContainerRequest<GenericImage>,
+    // Every ready condition in force, testcontainers holds the ones it can run as well
+    pub ready_conditions: Vec<RsWaitFor>,
+    // Target and digest of every copy source, for spec_key()
+    pub copy_sources: Vec<(String, String)>,
+}
+
+pub struct RsContainerStartResult {
+    result: Result<RsContainer, String>,
 }
 
 pub fn rs_container_request_destroy(container: Box<RsContainerRequest>) {
@@ -19,54 +39,42 @@ pub fn rs_container_request_with_cmd(
     container_request: Box<RsContainerRequest>,
     cmd: Vec<String>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_cmd(cmd),
-    ))
+    container_request.map(|request| request.with_cmd(cmd))
 }
 
 pub fn rs_container_request_with_name(
     container_request: Box<RsContainerRequest>,
     name: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_name(name),
-    ))
+    container_request.map(|request| request.with_name(name))
 }
 
 pub fn rs_container_request_with_tag(
     container_request: Box<RsContainerRequest>,
     tag: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_tag(tag),
-    ))
+    container_request.map(|request| request.with_tag(tag))
 }
 
 pub fn rs_container_request_with_container_name(
     container_request: Box<RsContainerRequest>,
     name: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_container_name(name),
-    ))
+    container_request.map(|request| request.with_container_name(name))
 }
 
 pub fn rs_container_request_with_platform(
     container_request: Box<RsContainerRequest>,
     platform: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_platform(platform),
-    ))
+    container_request.map(|request| request.with_platform(platform))
 }
 
 pub fn rs_container_request_with_network(
     container_request: Box<RsContainerRequest>,
     network: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_network(network),
-    ))
+    container_request.map(|request| request.with_network(network))
 }
 
 pub fn rs_container_request_with_label(
@@ -74,9 +82,7 @@ pub fn rs_container_request_with_label(
     key: String,
     value: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_label(key, value),
-    ))
+    container_request.map(|request| request.with_label(key, value))
 }
 
 pub fn rs_container_request_with_labels(
@@ -85,9 +91,7 @@ pub fn rs_container_request_with_labels(
     values: Vec<String>,
 ) -> Box<RsContainerRequest> {
     let rust_labels: Vec<(String, String)> = keys.into_iter().zip(values.into_iter()).collect();
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_labels(rust_labels),
-    ))
+    container_request.map(|request| request.with_labels(rust_labels))
 }
 
 pub fn rs_container_request_with_host(
@@ -95,18 +99,14 @@ pub fn rs_container_request_with_host(
     key: String,
     value: Box<RsHost>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_host(key, *value),
-    ))
+    container_request.map(|request| request.with_host(key, *value))
 }
 
 pub fn rs_container_request_with_mount(
     container_request: Box<RsContainerRequest>,
     mount: Box<RsMount>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_mount(*mount),
-    ))
+    container_request.map(|request| request.with_mount(*mount))
 }
 
 pub fn rs_container_request_with_env_var(
@@ -114,18 +114,14 @@ pub fn rs_container_request_with_env_var(
     name: String,
     value: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_env_var(name, value),
-    ))
+    container_request.map(|request| request.with_env_var(name, value))
 }
 
 pub fn rs_container_request_with_hostname(
     container_request: Box<RsContainerRequest>,
     hostname: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_hostname(hostname),
-    ))
+    container_request.map(|request| request.with_hostname(hostname))
 }
 
 pub fn rs_container_request_with_mapped_port(
@@ -133,128 +129,109 @@ pub fn rs_container_request_with_mapped_port(
     host_port: u16,
     container_port: Box<RsContainerPort>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request
-            .container
-            .with_mapped_port(host_port, (*container_port).into()),
-    ))
+    container_request.map(|request| request.with_mapped_port(host_port, (*container_port).into()))
 }
 
 pub fn rs_container_request_with_privileged(
     container_request: Box<RsContainerRequest>,
     privileged: bool,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_privileged(privileged),
-    ))
+    container_request.map(|request| request.with_privileged(privileged))
 }
 
 pub fn rs_container_request_with_cap_add(
     container_request: Box<RsContainerRequest>,
     capability: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_cap_add(capability),
-    ))
+    container_request.map(|request| request.with_cap_add(capability))
 }
 
 pub fn rs_container_request_with_cap_drop(
     container_request: Box<RsContainerRequest>,
     capability: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_cap_drop(capability),
-    ))
+    container_request.map(|request| request.with_cap_drop(capability))
 }
 
 pub fn rs_container_request_with_cgroupns_mode(
     container_request: Box<RsContainerRequest>,
     mode: Box<RsCgroupnsMode>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request
-            .container
-            .with_cgroupns_mode((*mode).into()),
-    ))
+    container_request.map(|request| request.with_cgroupns_mode((*mode).into()))
 }
 
 pub fn rs_container_request_with_userns_mode(
     container_request: Box<RsContainerRequest>,
     userns_mode: &str,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_userns_mode(userns_mode),
-    ))
+    container_request.map(|request| request.with_userns_mode(userns_mode))
 }
 
 pub fn rs_container_request_with_shm_size(
     container_request: Box<RsContainerRequest>,
     bytes: u64,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_shm_size(bytes),
-    ))
+    container_request.map(|request| request.with_shm_size(bytes))
 }
 
 pub fn rs_container_request_with_startup_timeout(
     container_request: Box<RsContainerRequest>,
     timeout_ns: u64,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request
-            .container
-            .with_startup_timeout(Duration::from_nanos(timeout_ns)),
-    ))
+    container_request.map(|request| request.with_startup_timeout(Duration::from_nanos(timeout_ns)))
 }
 
 pub fn rs_container_request_with_working_dir(
     container_request: Box<RsContainerRequest>,
     working_dir: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_working_dir(working_dir),
-    ))
+    container_request.map(|request| request.with_working_dir(working_dir))
+}
+
+pub fn rs_container_request_with_log_consumer(
+    container_request: Box<RsContainerRequest>,
+    callback: UniquePtr<LogConsumerCallback>,
+) -> Box<RsContainerRequest> {
+    container_request.map(|request| request.with_log_consumer(RsLogConsumer::new(callback)))
+}
+
+pub fn rs_container_request_with_reuse(
+    container_request: Box<RsContainerRequest>,
+    reuse: Box<RsReuseDirective>,
+) -> Box<RsContainerRequest> {
+    container_request.map(|request| request.with_reuse((*reuse).into()))
 }
 
 pub fn rs_container_request_with_user(
     container_request: Box<RsContainerRequest>,
     user: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_user(user),
-    ))
+    container_request.map(|request| request.with_user(user))
 }
 
 pub fn rs_container_request_with_readonly_rootfs(
     container_request: Box<RsContainerRequest>,
     readonly_rootfs: bool,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request
-            .container
-            .with_readonly_rootfs(readonly_rootfs),
-    ))
+    container_request.map(|request| request.with_readonly_rootfs(readonly_rootfs))
 }
 
 pub fn rs_container_request_with_security_opt(
     container_request: Box<RsContainerRequest>,
     security_opt: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_security_opt(security_opt),
-    ))
+    container_request.map(|request| request.with_security_opt(security_opt))
 }
 
 pub fn rs_container_request_with_ready_conditions(
     container_request: Box<RsContainerRequest>,
     ready_conditions: Vec<RsWaitFor>,
 ) -> Box<RsContainerRequest> {
-    let conditions: Vec<_> = ready_conditions.into_iter().map(|wf| wf.strategy).collect();
-    Box::new(RsContainerRequest::new(
-        container_request
-            .container
-            .with_ready_conditions(conditions),
-    ))
+    let conditions = upstream_conditions(&ready_conditions);
+    let mut container_request =
+        container_request.map(|request| request.with_ready_conditions(conditions));
+    container_request.ready_conditions = ready_conditions;
+    container_request
 }
 
 pub fn rs_container_request_with_copy_to(
@@ -262,9 +239,11 @@ pub fn rs_container_request_with_copy_to(
     target: String,
     source: Box<RsCopyDataSource>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request.container.with_copy_to(target, *source),
-    ))
+    let copy_source = (target.clone(), source.digest());
+    let mut container_request =
+        container_request.map(|request| request.with_copy_to(target, *source));
+    container_request.copy_sources.push(copy_source);
+    container_request
 }
 
 pub fn rs_container_request_with_ulimit(
@@ -274,46 +253,339 @@ pub fn rs_container_request_with_ulimit(
     hard_opt: Vec<i64>,
 ) -> Box<RsContainerRequest> {
     let hard_opt = hard_opt.first().copied();
-    Box::new(RsContainerRequest::new(
-        container_request
-            .container
-            .with_ulimit(name, soft, hard_opt),
-    ))
+    container_request.map(|request| request.with_ulimit(name, soft, hard_opt))
 }
 
 pub fn rs_container_request_with_health_check(
     container_request: Box<RsContainerRequest>,
     health_check: Box<RsHealthcheck>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        container_request
-            .container
-            .with_health_check(health_check.healthcheck),
-    ))
+    container_request.map(|request| request.with_health_check(health_check.healthcheck))
 }
 
 pub fn rs_container_request_start(
     container_request: Box<RsContainerRequest>,
 ) -> Result<Box<RsContainer>, String> {
-    let container = container_request
-        .container
-        .start()
-        .map_err(|e| format!("Failed to start container: {}", e))?;
-    Ok(Box::new(RsContainer::new(container)))
+    Ok(Box::new(runtime().block_on(container_request.start())?))
 }
 
 pub fn rs_container_request_pull(
     container_request: Box<RsContainerRequest>,
 ) -> Result<Box<RsContainerRequest>, String> {
-    let container_request = container_request
-        .container
-        .pull_image()
-        .map_err(|e| format!("Failed to pull container: {}", e))?;
-    Ok(Box::new(RsContainerRequest::new(container_request)))
+    Ok(Box::new(runtime().block_on(container_request.pull())?))
+}
+
+pub fn rs_container_request_start_async(
+    container_request: Box<RsContainerRequest>,
+) -> Box<RsAsyncTask> {
+    RsAsyncTask::spawn(async move {
+        container_request
+            .start()
+            .await
+            .map(RsAsyncOutput::Container)
+    })
+}
+
+pub fn rs_container_request_pull_async(
+    container_request: Box<RsContainerRequest>,
+) -> Box<RsAsyncTask> {
+    RsAsyncTask::spawn(async move {
+        container_request
+            .pull()
+            .await
+            .map(RsAsyncOutput::ContainerRequest)
+    })
+}
+
+pub fn rs_container_request_start_all(
+    container_requests: Vec<RsContainerRequest>,
+) -> Vec<RsContainerStartResult> {
+    // Nothing to start, so the shared runtime is not created either
+    if container_requests.is_empty() {
+        return Vec::new();
+    }
+    let runtime = runtime();
+    let handles: Vec<_> = container_requests
+        .into_iter()
+        .map(|container_request| runtime.spawn(container_request.start()))
+        .collect();
+    runtime.block_on(async move {
+        let mut results = Vec::with_capacity(handles.len());
+        for handle in handles {
+            let result = match handle.await {
+                Ok(container) => container,
+                Err(e) => Err(format!("Failed to start container: {}", e)),
+            };
+            results.push(RsContainerStartResult::new(result));
+        }
+        results
+    })
+}
+
+pub fn rs_container_request_clone(
+    container_request: &RsContainerRequest,
+) -> Box<RsContainerRequest> {
+    Box::new(RsContainerRequest {
+        container: container_request.container.clone(),
+        ready_conditions: container_request.ready_conditions.clone(),
+        copy_sources: container_request.copy_sources.clone(),
+    })
+}
+
+/// Stable key for requests that would start identical containers.
+///
+/// Every field that shapes the container is written in a canonical form: maps and sets sorted,
+/// copy sources by digest instead of content. The hash is the same in every process of a build,
+/// so the key can name containers that outlive it. Many fields are written in their upstream
+/// Debug form, which may change with the testcontainers-rs version.
+pub fn rs_container_request_spec_key(container_request: &RsContainerRequest) -> String {
+    container_request.spec_key()
+}
+
+// vec helpers
+pub fn rs_container_request_vec_push(
+    vec: &mut Vec<RsContainerRequest>,
+    container_request: Box<RsContainerRequest>,
+) {
+    vec.push(*container_request);
+}
+
+pub fn rs_container_start_result_vec_pop(
+    vec: &mut Vec<RsContainerStartResult>,
+) -> Result<Box<RsContainerStartResult>, String> {
+    vec.pop()
+        .map(Box::new)
+        .ok_or_else(|| "Vector is empty".to_string())
+}
+
+pub fn rs_container_start_result_into_container(
+    result: Box<RsContainerStartResult>,
+) -> Result<Box<RsContainer>, String> {
+    result.result.map(Box::new)
+}
+
+pub fn rs_container_start_result_destroy(result: Box<RsContainerStartResult>) {
+    drop(result);
+}
+
+impl RsContainerStartResult {
+    pub fn new(result: Result<RsContainer, String>) -> Self {
+        Self { result }
+    }
 }
 
 impl RsContainerRequest {
     pub fn new(container: ContainerRequest<GenericImage>) -> Self {
-        Self { container }
+        let ready_conditions = container
+            .ready_conditions()
+            .into_iter()
+            .map(RsWaitFor::new)
+            .collect();
+        Self {
+            container,
+            ready_conditions,
+            copy_sources: Vec::new(),
+        }
     }
+
+    /// Applies a testcontainers builder call, keeping the conditions checked after start.
+    pub fn map(
+        self: Box<Self>,
+        f: impl FnOnce(ContainerRequest<GenericImage>) -> ContainerRequest<GenericImage>,
+    ) -> Box<Self> {
+        let mut request = *self;
+        request.container = f(request.container);
+        Box::new(request)
+    }
+
+    pub fn spec_key(&self) -> String {
+        let request = &self.container;
+        let env_vars: BTreeMap<_, _> = request.env_vars().collect();
+        let hosts: BTreeMap<_, _> = request.hosts().collect();
+        let mut exposed_ports: Vec<_> = request.expose_ports().iter().map(debug).collect();
+        exposed_ports.sort();
+        let mut mapped_ports: Vec<_> = request.ports().into_iter().flatten().map(debug).collect();
+        mapped_ports.sort();
+        let mut mounts: Vec<_> = request.mounts().map(debug).collect();
+        mounts.sort();
+        let mut copy_sources = self.copy_sources.clone();
+        copy_sources.sort();
+        let cmd: Vec<_> = request.cmd().collect();
+        let conditions: Vec<_> = self
+            .ready_conditions
+            .iter()
+            .map(|condition| match &condition.native {
+                Some(native) if condition.native_only => native.to_string(),
+                _ => debug(&condition.strategy),
+            })
+            .collect();
+
+        let fields = [
+            ("image", request.descriptor()),
+            ("entrypoint", debug(&request.entrypoint())),
+            ("cmd", debug(&cmd)),
+            ("exposed_ports", debug(&exposed_ports)),
+            ("mapped_ports", debug(&mapped_ports)),
+            ("env_vars", debug(&env_vars)),
+            ("labels", debug(&request.labels())),
+            ("hosts", debug(&hosts)),
+            ("mounts", debug(&mounts)),
+            ("copy_sources", debug(&copy_sources)),
+            ("container_name", debug(&request.container_name())),
+            ("hostname", debug(&request.hostname())),
+            ("network", debug(&request.network())),
+            ("platform", debug(&request.platform())),
+            ("working_dir", debug(&request.working_dir())),
+            ("user", debug(&request.user())),
+            ("userns_mode", debug(&request.userns_mode())),
+            ("cgroupns_mode", debug(&request.cgroupns_mode())),
+            ("privileged", debug(&request.privileged())),
+            ("readonly_rootfs", debug(&request.readonly_rootfs())),
+            ("shm_size", debug(&request.shm_size())),
+            ("cap_add", debug(&request.cap_add())),
+            ("cap_drop", debug(&request.cap_drop())),
+            ("security_opts", debug(&request.security_opts())),
+            ("ulimits", debug(&request.ulimits())),
+            ("health_check", debug(&request.health_check())),
+            ("startup_timeout", debug(&request.startup_timeout())),
+            ("reuse", debug(&request.reuse())),
+            ("ready_conditions", debug(&conditions)),
+        ];
+        let mut hasher = StableHasher::new();
+        for (name, value) in &fields {
+            hasher.write_field(name);
+            hasher.write_field(value);
+        }
+        hasher.finish()
+    }
+
+    /// Starts the container, timing the pull, create, start and the ready conditions.
+    ///
+    /// Conditions testcontainers can run stay with it and run inside start, StartupTimeline tells
+    /// them apart afterwards. Only the native-only ones are run and timed here, after start.
+    pub async fn start(self) -> Result<RsContainer, String> {
+        let began = Instant::now();
+        let Self {
+            container,
+            ready_conditions,
+            ..
+        } = self;
+        let timeout = container
+            .startup_timeout()
+            .unwrap_or(native_wait::DEFAULT_STARTUP_TIMEOUT);
+
+        let upstream = ready_conditions
+            .iter()
+            .filter(|c| !c.native_only)
+            .map(|c| {
+                let description = c
+                    .native
+                    .as_ref()
+                    .map_or_else(|| debug(&c.strategy), ToString::to_string);
+                (description, c.native.clone())
+            })
+            .collect();
+        let natives: Vec<_> = ready_conditions
+            .into_iter()
+            .filter(|c| c.native_only)
+            .filter_map(|c| c.native)
+            .collect();
+
+        let reusable = container.reuse() != ReuseDirective::Never;
+        let (container, pull) = pull_if_missing(container).await?;
+
+        let create_began = SystemTime::now();
+        let container = container
+            .start()
+            .await
+            .map_err(|e| format!("Failed to start container: {}", e))?;
+        let start_returned = SystemTime::now();
+
+        // The startup timeout covers the whole start, what testcontainers used is gone.
+        // On failure the container is dropped here, which removes it
+        let remaining = timeout.saturating_sub(began.elapsed());
+        let timings = native_wait::wait_all(&natives, &container, remaining).await?;
+        let conditions = natives
+            .iter()
+            .map(ToString::to_string)
+            .zip(timings)
+            .collect();
+
+        let timeline = StartupTimeline::new(
+            pull,
+            create_began,
+            start_returned,
+            upstream,
+            conditions,
+            began.elapsed(),
+        );
+        Ok(RsContainer::started(container, timeline, reusable))
+    }
+
+    pub async fn pull(self) -> Result<Self, String> {
+        let container = self
+            .container
+            .pull_image()
+            .await
+            .map_err(|e| format!("Failed to pull container: {}", e))?;
+        Ok(Self {
+            container,
+            ready_conditions: self.ready_conditions,
+            copy_sources: self.copy_sources,
+        })
+    }
+}
+
+/// Pulls the image ahead of start when the daemon lacks it, so the pull can be timed on its own.
+///
+/// Whether an image is present is asked once per image and process. When that cannot be told,
+/// e.g. because the daemon cannot be reached from here, the image is left to testcontainers and
+/// a pull is counted as part of create.
+async fn pull_if_missing(
+    container: ContainerRequest<GenericImage>,
+) -> Result<(ContainerRequest<GenericImage>, Duration), String> {
+    let descriptor = container.descriptor();
+    if image_present(&descriptor) {
+        return Ok((container, Duration::ZERO));
+    }
+    let Ok(docker) = docker() else {
+        return Ok((container, Duration::ZERO));
+    };
+    match docker.inspect_image(&descriptor).await {
+        Err(bollard::errors::Error::DockerResponseServerError {
+            status_code: 404, ..
+        }) => {}
+        Ok(_) => {
+            mark_image_present(descriptor);
+            return Ok((container, Duration::ZERO));
+        }
+        Err(_) => return Ok((container, Duration::ZERO)),
+    }
+
+    let began = Instant::now();
+    let container = container
+        .pull_image()
+        .await
+        .map_err(|e| format!("Failed to pull container: {}", e))?;
+    let pull = began.elapsed();
+    mark_image_present(descriptor);
+    Ok((container, pull))
+}
+
+fn debug(value: &impl std::fmt::Debug) -> String {
+    format!("{:?}", value)
+}
+
+fn image_present(descriptor: &str) -> bool {
+    PRESENT_IMAGES
+        .lock()
+        .unwrap_or_else(|e| e.into_inner())
+        .contains(descriptor)
+}
+
+fn mark_image_present(descriptor: String) {
+    PRESENT_IMAGES
+        .lock()
+        .unwrap_or_else(|e| e.into_inner())
+        .insert(descriptor);
 }
@@ -0,0 +1,103 @@
+use crate::{
+    container_request::RsContainerRequest,
+    ffi::{RsContainerPortType, RsContainerSpec, RsMountSpec, RsMountType, RsPortSpec},
+};
+use std::time::Duration;
+use testcontainers::{
+    core::{AccessMode, ContainerPort, Mount},
+    ContainerRequest, GenericImage, ImageExt,
+};
+
+/// Builds the whole request in one call instead of one boxed round trip per option.
+pub fn rs_container_request_from_spec(spec: RsContainerSpec) -> Box<RsContainerRequest> {
+    let mut image = GenericImage::new(spec.name, spec.tag);
+    for port in &spec.exposed_ports {
+        image = image.with_exposed_port(container_port(port));
+    }
+    if let Some(entrypoint) = spec.entrypoint_opt.first() {
+        image = image.with_entrypoint(entrypoint);
+    }
+
+    let mut request: ContainerRequest<GenericImage> = image.into();
+    if !spec.cmd.is_empty() {
+        request = request.with_cmd(spec.cmd);
+    }
+    for mapping in &spec.mapped_ports {
+        request =
+            request.with_mapped_port(mapping.host_port, container_port(&mapping.container_port));
+    }
+    for (name, value) in spec.env_keys.into_iter().zip(spec.env_values) {
+        request = request.with_env_var(name, value);
+    }
+    if !spec.label_keys.is_empty() {
+        request = request.with_labels(spec.label_keys.into_iter().zip(spec.label_values));
+    }
+    for mount_spec in spec.mounts {
+        request = request.with_mount(mount(mount_spec));
+    }
+    if let Some(name) = spec.container_name_opt.into_iter().next() {
+        request = request.with_container_name(name);
+    }
+    if let Some(hostname) = spec.hostname_opt.into_iter().next() {
+        request = request.with_hostname(hostname);
+    }
+    if let Some(network) = spec.network_opt.into_iter().next() {
+        request = request.with_network(network);
+    }
+    if let Some(platform) = spec.platform_opt.into_iter().next() {
+        request = request.with_platform(platform);
+    }
+    if let Some(working_dir) = spec.working_dir_opt.into_iter().next() {
+        request = request.with_working_dir(working_dir);
+    }
+    if let Some(user) = spec.user_opt.into_iter().next() {
+        request = request.with_user(user);
+    }
+    if let Some(userns_mode) = spec.userns_mode_opt.first() {
+        request = request.with_userns_mode(userns_mode);
+    }
+    if spec.privileged {
+        request = request.with_privileged(true);
+    }
+    if spec.readonly_rootfs {
+        request = request.with_readonly_rootfs(true);
+    }
+    if let Some(bytes) = spec.shm_size_opt.first() {
+        request = request.with_shm_size(*bytes);
+    }
+    if let Some(timeout_ns) = spec.startup_timeout_ns_opt.first() {
+        request = request.with_startup_timeout(Duration::from_nanos(*timeout_ns));
+    }
+    for capability in spec.cap_add {
+        request = request.with_cap_add(capability);
+    }
+    for capability in spec.cap_drop {
+        request = request.with_cap_drop(capability);
+    }
+    for security_opt in spec.security_opts {
+        request = request.with_security_opt(security_opt);
+    }
+
+    Box::new(RsContainerRequest::new(request))
+}
+
+fn container_port(spec: &RsPortSpec) -> ContainerPort {
+    match spec.port_type {
+        RsContainerPortType::Udp => ContainerPort::Udp(spec.port),
+        RsContainerPortType::Sctp => ContainerPort::Sctp(spec.port),
+        _ => ContainerPort::Tcp(spec.port),
+    }
+}
+
+fn mount(spec: RsMountSpec) -> Mount {
+    let mount = match spec.mount_type {
+        RsMountType::Volume => Mount::volume_mount(spec.source, spec.target),
+        RsMountType::Tmpfs => Mount::tmpfs_mount(spec.target),
+        _ => Mount::bind_mount(spec.source, spec.target),
+    };
+    if spec.read_only {
+        mount.with_access_mode(AccessMode::ReadOnly)
+    } else {
+        mount
+    }
+}
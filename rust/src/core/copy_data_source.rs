@@ -1,16 +1,42 @@
+use crate::{docker::docker, system::digest::digest, system::path::RsPath};
+use bollard::container::UploadToContainerOptions;
+use bytes::Bytes;
+use futures::stream;
+use memmap2::Mmap;
+use std::{
+    fs::File,
+    path::{Path, PathBuf},
+    time::UNIX_EPOCH,
+};
 use testcontainers::core::CopyDataSource;
-use crate::system::path::RsPath;
+
+const TAR_BLOCK_SIZE: usize = 512;
+
+enum Source {
+    Copy(CopyDataSource),
+    MappedFile(PathBuf),
+}
 
 pub struct RsCopyDataSource {
-    source: CopyDataSource,
+    source: Source,
 }
 
 pub fn rs_copy_data_source_file(path: Box<RsPath>) -> Box<RsCopyDataSource> {
     Box::new(RsCopyDataSource::new(CopyDataSource::File(path.path)))
 }
 
-pub fn rs_copy_data_source_data(data: Vec<u8>) -> Box<RsCopyDataSource> {
-    Box::new(RsCopyDataSource::new(CopyDataSource::Data(data)))
+pub fn rs_copy_data_source_data(data: &[u8]) -> Box<RsCopyDataSource> {
+    Box::new(RsCopyDataSource::new(CopyDataSource::Data(data.to_vec())))
+}
+
+pub fn rs_copy_data_source_mapped_file(path: Box<RsPath>) -> Box<RsCopyDataSource> {
+    Box::new(RsCopyDataSource {
+        source: Source::MappedFile(path.path),
+    })
+}
+
+pub fn rs_copy_data_source_is_mapped_file(source: &RsCopyDataSource) -> bool {
+    matches!(source.source, Source::MappedFile(_))
 }
 
 pub fn rs_copy_data_source_destroy(source: Box<RsCopyDataSource>) {
@@ -19,13 +45,107 @@ pub fn rs_copy_data_source_destroy(source: Box<RsCopyDataSource>) {
 
 impl RsCopyDataSource {
     pub fn new(source: CopyDataSource) -> Self {
-        Self { source }
+        Self {
+            source: Source::Copy(source),
+        }
+    }
+
+    /// Identifies the content for ContainerRequest::spec_key(), without carrying it. Files are
+    /// identified by path, size and modification time, they are only read when the container
+    /// starts.
+    pub fn digest(&self) -> String {
+        match &self.source {
+            Source::Copy(CopyDataSource::Data(data)) => format!("data:{}", digest(data)),
+            Source::Copy(CopyDataSource::File(path)) | Source::MappedFile(path) => {
+                format!("file:{}:{}", path.display(), file_version(path))
+            }
+            #[allow(unreachable_patterns)]
+            Source::Copy(source) => format!("{:?}", source),
+        }
+    }
+
+    /// Uploads the source into a container as a single-entry tar stream.
+    /// Files are memory-mapped, so their content is never buffered on the heap.
+    pub async fn upload(self, container_id: &str, target: &str) -> Result<(), String> {
+        let content = match self.source {
+            Source::Copy(CopyDataSource::Data(data)) => Bytes::from(data),
+            Source::Copy(CopyDataSource::File(path)) | Source::MappedFile(path) => map_file(&path)?,
+            #[allow(unreachable_patterns)]
+            Source::Copy(_) => return Err("Failed to copy: unsupported data source".to_string()),
+        };
+
+        let header = tar_header(target, content.len())?;
+        let padding = (TAR_BLOCK_SIZE - content.len() % TAR_BLOCK_SIZE) % TAR_BLOCK_SIZE;
+        // The entry padding is followed by the two zero blocks terminating the archive
+        let trailer = Bytes::from(vec![0u8; padding + 2 * TAR_BLOCK_SIZE]);
+
+        let options = UploadToContainerOptions {
+            path: "/".to_string(),
+            ..Default::default()
+        };
+        docker()?
+            .upload_to_container_streaming(
+                container_id,
+                Some(options),
+                stream::iter([header, content, trailer]),
+            )
+            .await
+            .map_err(|e| format!("Failed to copy to container: {}", e))
     }
 }
 
 impl Into<CopyDataSource> for RsCopyDataSource {
     fn into(self) -> CopyDataSource {
-        self.source
+        match self.source {
+            Source::Copy(source) => source,
+            // Rejected by with_copy_to, testcontainers-rs could only read the whole file
+            Source::MappedFile(path) => CopyDataSource::File(path),
+        }
+    }
+}
+
+/// Size and modification time, which change along with the content of a file without it being
+/// read. A file that cannot be stat'ed is keyed by the error, starting from it fails anyway.
+fn file_version(path: &Path) -> String {
+    match std::fs::metadata(path) {
+        Ok(metadata) => {
+            let modified = metadata
+                .modified()
+                .ok()
+                .and_then(|modified| modified.duration_since(UNIX_EPOCH).ok())
+                .unwrap_or_default();
+            format!("{}:{}", metadata.len(), modified.as_nanos())
+        }
+        Err(e) => format!("{:?}", e.kind()),
     }
 }
 
+fn map_file(path: &PathBuf) -> Result<Bytes, String> {
+    let file = File::open(path)
+        .map_err(|e| format!("Failed to open {}: {}", path.display(), e))?;
+    let len = file
+        .metadata()
+        .map_err(|e| format!("Failed to stat {}: {}", path.display(), e))?
+        .len();
+    if len == 0 {
+        // Zero-length mappings are rejected by the OS
+        return Ok(Bytes::new());
+    }
+    // Safety: the mapping is read-only; concurrent truncation of the file by another process
+    // is outside of what this API guards against, as with any mmap-based reader
+    let mmap = unsafe { Mmap::map(&file) }
+        .map_err(|e| format!("Failed to map {}: {}", path.display(), e))?;
+    Ok(Bytes::from_owner(mmap))
+}
+
+fn tar_header(target: &str, size: usize) -> Result<Bytes, String> {
+    let mut header = tar::Header::new_ustar();
+    header
+        .set_path(target.trim_start_matches('/'))
+        .map_err(|e| format!("Failed to copy to {}: {}", target, e))?;
+    header.set_size(size as u64);
+    header.set_mode(0o644);
+    header.set_entry_type(tar::EntryType::Regular);
+    header.set_cksum();
+    Ok(Bytes::copy_from_slice(header.as_bytes()))
+}
@@ -1,8 +1,13 @@
-use testcontainers::core::ExecCommand;
-use crate::core::wait::wait_for::RsWaitFor;
+use testcontainers::core::{ExecCommand, ExecResult};
+use testcontainers::{ContainerAsync, GenericImage};
+use crate::core::wait::{
+    native_wait::{self, NativeWait},
+    wait_for::{split_conditions, RsWaitFor},
+};
 
 pub struct RsExecCommand {
     pub command: ExecCommand,
+    pub native_waits: Vec<NativeWait>,
 }
 
 pub fn rs_exec_command_new(cmd: Vec<String>) -> Box<RsExecCommand> {
@@ -13,10 +18,11 @@ pub fn rs_exec_command_with_container_ready_conditions(
     command: Box<RsExecCommand>,
     ready_conditions: Vec<RsWaitFor>,
 ) -> Box<RsExecCommand> {
-    let conditions: Vec<_> = ready_conditions.into_iter().map(|wf| wf.strategy).collect();
-    Box::new(RsExecCommand::new(
-        command.command.with_container_ready_conditions(conditions),
-    ))
+    let (conditions, native_waits) = split_conditions(ready_conditions);
+    Box::new(RsExecCommand {
+        command: command.command.with_container_ready_conditions(conditions),
+        native_waits,
+    })
 }
 
 pub fn rs_exec_command_destroy(command: Box<RsExecCommand>) {
@@ -25,7 +31,19 @@ pub fn rs_exec_command_destroy(command: Box<RsExecCommand>) {
 
 impl RsExecCommand {
     pub fn new(command: ExecCommand) -> Self {
-        Self { command }
+        Self {
+            command,
+            native_waits: Vec::new(),
+        }
     }
-}
 
+    pub async fn run(self, container: &ContainerAsync<GenericImage>) -> Result<ExecResult, String> {
+        let result = container
+            .exec(self.command)
+            .await
+            .map_err(|e| format!("Failed to exec command: {}", e))?;
+        let timeout = native_wait::DEFAULT_STARTUP_TIMEOUT;
+        native_wait::wait_all(&self.native_waits, container, timeout).await?;
+        Ok(result)
+    }
+}
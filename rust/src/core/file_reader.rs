@@ -0,0 +1,155 @@
+use crate::{docker::docker, runtime::runtime};
+use bollard::container::DownloadFromContainerOptions;
+use futures::TryStreamExt;
+use std::{io, path::Path, pin::Pin};
+use tokio::io::{AsyncRead, AsyncReadExt};
+use tokio_util::io::StreamReader;
+
+const TAR_BLOCK_SIZE: u64 = 512;
+
+/// Content of a single file inside a container, streamed out of the Docker archive endpoint.
+pub struct RsFileReader {
+    reader: Pin<Box<dyn AsyncRead + Send>>,
+    size: u64,
+    delivered: u64,
+}
+
+pub fn rs_file_reader_read(reader: &mut RsFileReader, buf: &mut [u8]) -> Result<usize, String> {
+    let read = runtime()
+        .block_on(reader.reader.read(buf))
+        .map_err(|e| format!("Failed to read file from container: {}", e))?;
+    // take() ends cleanly when the archive stream does, a short file must not look complete
+    if read == 0 && !buf.is_empty() && reader.delivered < reader.size {
+        return Err(format!(
+            "Failed to read file from container: {}",
+            truncated(reader.delivered, reader.size)
+        ));
+    }
+    reader.delivered += read as u64;
+    Ok(read)
+}
+
+pub fn rs_file_reader_size(reader: &RsFileReader) -> u64 {
+    reader.size
+}
+
+pub fn rs_file_reader_destroy(reader: Box<RsFileReader>) {
+    let _guard = runtime().enter();
+    drop(reader);
+}
+
+impl RsFileReader {
+    pub async fn open(container_id: &str, path: &str) -> Result<Self, String> {
+        let options = DownloadFromContainerOptions {
+            path: path.to_string(),
+        };
+        let stream = docker()?
+            .download_from_container(container_id, Some(options))
+            .map_err(io::Error::other);
+        let mut archive = StreamReader::new(Box::pin(stream));
+
+        let size = seek_first_file(&mut archive)
+            .await
+            .map_err(|e| format!("Failed to copy {} from container: {}", path, e))?;
+
+        Ok(Self {
+            reader: Box::pin(archive.take(size)),
+            size,
+            delivered: 0,
+        })
+    }
+
+    /// Streams the file to the host without passing its content through C++.
+    pub async fn copy_to_host(mut self, host_path: &Path) -> Result<(), String> {
+        let mut file = tokio::fs::File::create(host_path)
+            .await
+            .map_err(|e| format!("Failed to create {}: {}", host_path.display(), e))?;
+        let copied = tokio::io::copy(&mut self.reader, &mut file)
+            .await
+            .map_err(|e| format!("Failed to write {}: {}", host_path.display(), e))?;
+        let delivered = self.delivered + copied;
+        if delivered < self.size {
+            return Err(format!(
+                "Failed to write {}: {}",
+                host_path.display(),
+                truncated(delivered, self.size)
+            ));
+        }
+        Ok(())
+    }
+}
+
+fn truncated(delivered: u64, size: u64) -> io::Error {
+    io::Error::new(
+        io::ErrorKind::UnexpectedEof,
+        format!("archive ended after {} of {} bytes", delivered, size),
+    )
+}
+
+/// Consumes tar headers up to the first regular file and returns its size.
+/// Metadata entries (pax, GNU long names) preceding it are skipped, except for the size record
+/// of a pax header, which holds the real size of files beyond the 8 GiB of the ustar field.
+async fn seek_first_file<R: AsyncRead + Unpin>(archive: &mut R) -> io::Result<u64> {
+    let mut header = [0u8; TAR_BLOCK_SIZE as usize];
+    let mut pax_size = None;
+    loop {
+        archive.read_exact(&mut header).await?;
+        if header.iter().all(|b| *b == 0) {
+            return Err(io::Error::new(io::ErrorKind::NotFound, "archive is empty"));
+        }
+
+        let size = parse_size(&header[124..136])?;
+        let padded = size.div_ceil(TAR_BLOCK_SIZE) * TAR_BLOCK_SIZE;
+        match header[156] {
+            b'0' | b'\0' | b'7' => return Ok(pax_size.unwrap_or(size)),
+            b'x' => {
+                let mut records = Vec::new();
+                (&mut *archive).take(padded).read_to_end(&mut records).await?;
+                records.truncate(size as usize);
+                pax_size = parse_pax_size(&records)?.or(pax_size);
+            }
+            b'g' | b'L' | b'K' => {
+                tokio::io::copy(&mut (&mut *archive).take(padded), &mut tokio::io::sink()).await?;
+            }
+            b'5' => return Err(io::Error::other("path is a directory")),
+            _ => return Err(io::Error::other("path is not a regular file")),
+        }
+    }
+}
+
+/// Finds the size record among pax records of the form "<length> <key>=<value>\n".
+fn parse_pax_size(mut records: &[u8]) -> io::Result<Option<u64>> {
+    let invalid = || io::Error::other("invalid pax header");
+    let mut size = None;
+    while !records.is_empty() {
+        let space = records.iter().position(|b| *b == b' ').ok_or_else(invalid)?;
+        let length: usize = std::str::from_utf8(&records[..space])
+            .ok()
+            .and_then(|length| length.parse().ok())
+            .filter(|length| *length > space && *length <= records.len())
+            .ok_or_else(invalid)?;
+        let record = &records[space + 1..length];
+        let record = record.strip_suffix(b"\n").unwrap_or(record);
+        if let Some(value) = record.strip_prefix(b"size=") {
+            size = std::str::from_utf8(value).ok().and_then(|value| value.parse().ok());
+            if size.is_none() {
+                return Err(invalid());
+            }
+        }
+        records = &records[length..];
+    }
+    Ok(size)
+}
+
+fn parse_size(field: &[u8]) -> io::Result<u64> {
+    // GNU base-256 encoding for sizes beyond the octal range
+    if field[0] & 0x80 != 0 {
+        return Ok(field[1..]
+            .iter()
+            .fold(u64::from(field[0] & 0x7f), |size, b| (size << 8) | u64::from(*b)));
+    }
+    let digits = std::str::from_utf8(field)
+        .map_err(|_| io::Error::other("invalid tar header"))?
+        .trim_matches(|c: char| c == '\0' || c == ' ');
+    u64::from_str_radix(digits, 8).map_err(|_| io::Error::other("invalid tar header"))
+}
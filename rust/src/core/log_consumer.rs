@@ -0,0 +1,103 @@
+use crate::{ffi::LogConsumerCallback, runtime::runtime};
+use cxx::UniquePtr;
+use futures::future::BoxFuture;
+use std::sync::Mutex;
+use testcontainers::core::logs::{consumer::LogConsumer, LogFrame};
+use tokio::sync::mpsc;
+
+// The callback is only ever invoked from one thread at a time, see forward()
+unsafe impl Send for LogConsumerCallback {}
+
+const MAX_BATCH_FRAMES: usize = 256;
+const MAX_BATCH_BYTES: usize = 1 << 20;
+
+/// Forwards log frames to a C++ callback.
+///
+/// Frames are queued without blocking the log reader. A background task drains the queue and
+/// delivers whatever has accumulated as one batch, so a chatty container costs one FFI crossing
+/// per batch rather than per frame.
+///
+/// The task is spawned with the first frame, so a request that is built but never started
+/// neither creates the shared runtime nor leaves a task behind.
+pub struct RsLogConsumer {
+    frames: mpsc::UnboundedSender<LogFrame>,
+    forwarder: Mutex<Option<Forwarder>>,
+}
+
+type Forwarder = (mpsc::UnboundedReceiver<LogFrame>, UniquePtr<LogConsumerCallback>);
+
+impl RsLogConsumer {
+    pub fn new(callback: UniquePtr<LogConsumerCallback>) -> Self {
+        let (frames, receiver) = mpsc::unbounded_channel();
+        Self {
+            frames,
+            forwarder: Mutex::new(Some((receiver, callback))),
+        }
+    }
+
+    fn start_forwarder(&self) {
+        let forwarder = self
+            .forwarder
+            .lock()
+            .unwrap_or_else(|e| e.into_inner())
+            .take();
+        if let Some((receiver, callback)) = forwarder {
+            runtime().spawn(forward(receiver, callback));
+        }
+    }
+}
+
+impl LogConsumer for RsLogConsumer {
+    fn accept<'a>(&'a self, record: &'a LogFrame) -> BoxFuture<'a, ()> {
+        self.start_forwarder();
+        // Err means the forwarder is gone, there is nobody left to deliver to
+        let _ = self.frames.send(record.clone());
+        Box::pin(async {})
+    }
+}
+
+async fn forward(
+    mut receiver: mpsc::UnboundedReceiver<LogFrame>,
+    mut callback: UniquePtr<LogConsumerCallback>,
+) {
+    let mut data = Vec::new();
+    let mut ends = Vec::new();
+    let mut sources = Vec::new();
+
+    while let Some(first) = receiver.recv().await {
+        push_frame(&first, &mut data, &mut ends, &mut sources);
+        while ends.len() < MAX_BATCH_FRAMES && data.len() < MAX_BATCH_BYTES {
+            match receiver.try_recv() {
+                Ok(frame) => push_frame(&frame, &mut data, &mut ends, &mut sources),
+                Err(_) => break,
+            }
+        }
+
+        let batch = tokio::task::spawn_blocking(move || {
+            if let Some(consumer) = callback.as_ref() {
+                // Err is an exception thrown by the user callback, it must not stop the logs
+                let _ = consumer.consume(&data, &ends, &sources);
+            }
+            data.clear();
+            ends.clear();
+            sources.clear();
+            (callback, data, ends, sources)
+        })
+        .await;
+
+        match batch {
+            Ok(state) => (callback, data, ends, sources) = state,
+            Err(_) => return,
+        }
+    }
+}
+
+fn push_frame(frame: &LogFrame, data: &mut Vec<u8>, ends: &mut Vec<usize>, sources: &mut Vec<u8>) {
+    let (bytes, source) = match frame {
+        LogFrame::StdOut(bytes) => (bytes, 0),
+        LogFrame::StdErr(bytes) => (bytes, 1),
+    };
+    data.extend_from_slice(bytes);
+    ends.push(data.len());
+    sources.push(source);
+}
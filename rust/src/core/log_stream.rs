@@ -0,0 +1,32 @@
+use crate::runtime::runtime;
+use std::pin::Pin;
+use tokio::io::{AsyncBufRead, AsyncBufReadExt, AsyncReadExt};
+
+pub struct RsLogStream {
+    reader: Pin<Box<dyn AsyncBufRead + Send>>,
+}
+
+pub fn rs_log_stream_read(stream: &mut RsLogStream, buf: &mut [u8]) -> Result<usize, String> {
+    runtime()
+        .block_on(stream.reader.read(buf))
+        .map_err(|e| format!("Failed to read log stream: {}", e))
+}
+
+pub fn rs_log_stream_read_line(stream: &mut RsLogStream, line: &mut Vec<u8>) -> Result<bool, String> {
+    line.clear();
+    runtime()
+        .block_on(stream.reader.read_until(b'\n', line))
+        .map_err(|e| format!("Failed to read log stream: {}", e))
+        .map(|read| read > 0)
+}
+
+pub fn rs_log_stream_destroy(stream: Box<RsLogStream>) {
+    let _guard = runtime().enter();
+    drop(stream);
+}
+
+impl RsLogStream {
+    pub fn new(reader: Pin<Box<dyn AsyncBufRead + Send>>) -> Self {
+        Self { reader }
+    }
+}
@@ -2,7 +2,12 @@ pub mod cgroupns_mode;
 pub mod container_port;
 pub mod copy_data_source;
 pub mod exec;
+pub mod file_reader;
 pub mod healthcheck;
 pub mod host;
+pub mod log_consumer;
+pub mod log_stream;
 pub mod mount;
+pub mod reuse_directive;
+pub mod startup_profile;
 pub mod wait;
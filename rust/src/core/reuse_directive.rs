@@ -0,0 +1,33 @@
+use testcontainers::core::ReuseDirective;
+
+pub struct RsReuseDirective {
+    directive: ReuseDirective,
+}
+
+pub fn rs_reuse_directive_never() -> Box<RsReuseDirective> {
+    Box::new(RsReuseDirective::new(ReuseDirective::Never))
+}
+
+pub fn rs_reuse_directive_always() -> Box<RsReuseDirective> {
+    Box::new(RsReuseDirective::new(ReuseDirective::Always))
+}
+
+pub fn rs_reuse_directive_current_session() -> Box<RsReuseDirective> {
+    Box::new(RsReuseDirective::new(ReuseDirective::CurrentSession))
+}
+
+pub fn rs_reuse_directive_destroy(directive: Box<RsReuseDirective>) {
+    drop(directive);
+}
+
+impl RsReuseDirective {
+    pub fn new(directive: ReuseDirective) -> Self {
+        Self { directive }
+    }
+}
+
+impl Into<ReuseDirective> for RsReuseDirective {
+    fn into(self) -> ReuseDirective {
+        self.directive
+    }
+}
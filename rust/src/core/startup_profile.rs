@@ -0,0 +1,225 @@
+use crate::{
+    core::wait::native_wait::{self, NativeWait},
+    docker::docker,
+    ffi::{RsConditionTiming, RsStartupProfile},
+};
+use bollard::{container::InspectContainerOptions, models::ContainerState};
+use std::time::{Duration, SystemTime, UNIX_EPOCH};
+use tokio::sync::OnceCell;
+
+/// Results the daemon keeps in State.Health.Log, older ones are dropped.
+const HEALTH_LOG_LENGTH: usize = 5;
+
+/// Timings taken by RsContainerRequest::start on our side of the testcontainers call.
+///
+/// Create, start and the ready conditions testcontainers runs happen inside one testcontainers
+/// call. They are told apart later from what the daemon recorded: the Created and
+/// State.StartedAt timestamps, the log timestamps of log conditions, the health log and
+/// State.FinishedAt. This assumes the daemon clock agrees with ours, as it does for a local
+/// daemon. The daemon is asked on the first profile() call only, a restart of the container
+/// afterwards does not change the profile.
+pub struct StartupTimeline {
+    pull: Duration,
+    create_began: SystemTime,
+    start_returned: SystemTime,
+    /// Ready conditions testcontainers ran before start_returned, in order, with their
+    /// description and our own form of them where there is one
+    upstream: Vec<(String, Option<NativeWait>)>,
+    conditions: Vec<(String, Duration)>,
+    total: Duration,
+    split: OnceCell<Split>,
+}
+
+/// The part of the startup that is only known from what the daemon recorded.
+struct Split {
+    create: Duration,
+    start: Duration,
+    upstream: Vec<(String, Duration)>,
+}
+
+impl StartupTimeline {
+    pub fn new(
+        pull: Duration,
+        create_began: SystemTime,
+        start_returned: SystemTime,
+        upstream: Vec<(String, Option<NativeWait>)>,
+        conditions: Vec<(String, Duration)>,
+        total: Duration,
+    ) -> Self {
+        Self {
+            pull,
+            create_began,
+            start_returned,
+            upstream,
+            conditions,
+            total,
+            split: OnceCell::new(),
+        }
+    }
+
+    pub async fn profile(&self, container_id: &str) -> Result<RsStartupProfile, String> {
+        let split = self
+            .split
+            .get_or_try_init(|| self.split(container_id))
+            .await?;
+
+        let conditions = split
+            .upstream
+            .iter()
+            .chain(&self.conditions)
+            .map(|(description, duration)| RsConditionTiming {
+                description: description.clone(),
+                duration_ns: nanos(*duration),
+            })
+            .collect();
+
+        Ok(RsStartupProfile {
+            pull_ns: nanos(self.pull),
+            create_ns: nanos(split.create),
+            start_ns: nanos(split.start),
+            conditions,
+            total_ns: nanos(self.total),
+        })
+    }
+
+    async fn split(&self, container_id: &str) -> Result<Split, String> {
+        let inspect = docker()?
+            .inspect_container(container_id, None::<InspectContainerOptions>)
+            .await
+            .map_err(|e| format!("Failed to inspect container: {}", e))?;
+        let state = inspect.state.unwrap_or_default();
+        let created = inspect.created.as_deref().and_then(parse_timestamp);
+        let started = state.started_at.as_deref().and_then(parse_timestamp);
+
+        match (created, started) {
+            // A reused container was started by an earlier session, nothing was created now
+            (_, Some(started)) if started < self.create_began => Ok(Split {
+                create: Duration::ZERO,
+                start: Duration::ZERO,
+                upstream: self.unsplit_conditions(self.create_began),
+            }),
+            (Some(created), Some(started)) if started <= self.start_returned => Ok(Split {
+                create: elapsed(self.create_began, created),
+                start: elapsed(created, started),
+                upstream: self.condition_timings(container_id, &state, started).await?,
+            }),
+            // Missing timestamps, or a restart since start() returned
+            _ => Ok(Split {
+                create: elapsed(self.create_began, self.start_returned),
+                start: Duration::ZERO,
+                upstream: self.unsplit_conditions(self.start_returned),
+            }),
+        }
+    }
+
+    /// Splits the time from StartedAt to the return of start across the conditions testcontainers
+    /// ran. A condition whose end the daemon did not record is merged into the entry of the next
+    /// one that is known, or into the last entry, which ends when start returned.
+    async fn condition_timings(
+        &self,
+        container_id: &str,
+        state: &ContainerState,
+        started: SystemTime,
+    ) -> Result<Vec<(String, Duration)>, String> {
+        let mut timings = Vec::with_capacity(self.upstream.len());
+        let mut pending = Vec::new();
+        let mut previous = started;
+        for (description, native) in &self.upstream {
+            pending.push(description.as_str());
+            let Some(held) = self.held_at(container_id, native.as_ref(), state, previous).await?
+            else {
+                continue;
+            };
+            // Conditions run one after another, none can hold before the previous one did
+            let held = held.max(previous).min(self.start_returned);
+            timings.push((pending.join(" and "), elapsed(previous, held)));
+            pending.clear();
+            previous = held;
+        }
+        if !pending.is_empty() {
+            timings.push((pending.join(" and "), elapsed(previous, self.start_returned)));
+        }
+        Ok(timings)
+    }
+
+    /// When a condition testcontainers began checking at previous held, as far as the daemon
+    /// recorded it.
+    async fn held_at(
+        &self,
+        container_id: &str,
+        native: Option<&NativeWait>,
+        state: &ContainerState,
+        previous: SystemTime,
+    ) -> Result<Option<SystemTime>, String> {
+        Ok(match native {
+            Some(NativeWait::Nothing) => Some(previous),
+            Some(NativeWait::Duration(length)) => previous.checked_add(*length),
+            Some(NativeWait::Log(log)) if log.holds_at_once() => Some(previous),
+            Some(NativeWait::Log(log)) => {
+                native_wait::log_satisfied_at(container_id, log, self.start_returned)
+                    .await?
+                    .as_deref()
+                    .and_then(parse_timestamp)
+            }
+            Some(NativeWait::Healthcheck { .. }) => self.healthy_at(state, previous),
+            Some(NativeWait::Exit { .. }) => state.finished_at.as_deref().and_then(parse_timestamp),
+            // HTTP requests leave no trace at the daemon
+            _ => None,
+        })
+    }
+
+    /// End of the first passing healthcheck after since. Unknown once the health log is full and
+    /// that result is its oldest, an earlier one may have been dropped.
+    fn healthy_at(&self, state: &ContainerState, since: SystemTime) -> Option<SystemTime> {
+        let log = state.health.as_ref()?.log.as_ref()?;
+        let (index, end) = log.iter().enumerate().find_map(|(index, result)| {
+            let end = result.end.as_deref().and_then(parse_timestamp)?;
+            let passed = result.exit_code == Some(0);
+            (passed && end >= since && end <= self.start_returned).then_some((index, end))
+        })?;
+        (index > 0 || log.len() < HEALTH_LOG_LENGTH).then_some(end)
+    }
+
+    /// A single entry for all conditions testcontainers ran, from since to the return of start.
+    fn unsplit_conditions(&self, since: SystemTime) -> Vec<(String, Duration)> {
+        if self.upstream.is_empty() {
+            return Vec::new();
+        }
+        let descriptions: Vec<_> = self.upstream.iter().map(|(d, _)| d.as_str()).collect();
+        vec![(descriptions.join(" and "), elapsed(since, self.start_returned))]
+    }
+}
+
+fn elapsed(earlier: SystemTime, later: SystemTime) -> Duration {
+    later.duration_since(earlier).unwrap_or_default()
+}
+
+fn nanos(duration: Duration) -> u64 {
+    u64::try_from(duration.as_nanos()).unwrap_or(u64::MAX)
+}
+
+/// Parses the RFC 3339 UTC timestamps of the Engine API, e.g. 2024-05-01T12:34:56.123456789Z.
+fn parse_timestamp(timestamp: &str) -> Option<SystemTime> {
+    let (date, time) = timestamp.strip_suffix('Z')?.split_once('T')?;
+    let mut date = date.splitn(3, '-').map(|part| part.parse::<i64>().ok());
+    let (year, month, day) = (date.next()??, date.next()??, date.next()??);
+
+    let (clock, fraction) = time.split_once('.').unwrap_or((time, "0"));
+    let mut clock = clock.splitn(3, ':').map(|part| part.parse::<u64>().ok());
+    let (hours, minutes, seconds) = (clock.next()??, clock.next()??, clock.next()??);
+    let fraction = &fraction[..fraction.len().min(9)];
+    let nanos = format!("{:0<9}", fraction).parse::<u32>().ok()?;
+
+    // Days since the epoch of a proleptic Gregorian date, see Howard Hinnant's days_from_civil
+    let year = if month <= 2 { year - 1 } else { year };
+    let era = year.div_euclid(400);
+    let year_of_era = year - era * 400;
+    let day_of_year = (153 * ((month + 9) % 12) + 2) / 5 + day - 1;
+    let day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    // Docker reports never-set timestamps as 0001-01-01, those end up negative here
+    let days = u64::try_from(era * 146_097 + day_of_era - 719_468).ok()?;
+
+    let seconds = days * 86_400 + hours * 3_600 + minutes * 60 + seconds;
+    Some(UNIX_EPOCH + Duration::new(seconds, nanos))
+}
+
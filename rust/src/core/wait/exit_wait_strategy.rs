@@ -1,8 +1,14 @@
+use crate::core::wait::native_wait::{
+    NativeWait, PollBackoff, DEFAULT_POLL_INTERVAL, MIN_POLL_INTERVAL,
+};
 use testcontainers::core::wait::ExitWaitStrategy;
 use std::time::Duration;
 
 pub struct RsExitWaitStrategy {
     pub strategy: ExitWaitStrategy,
+    poll: PollBackoff,
+    exit_code: Option<i64>,
+    pub events: bool,
 }
 
 pub fn rs_exit_wait_strategy_destroy(strategy: Box<RsExitWaitStrategy>) {
@@ -17,7 +23,9 @@ pub fn rs_exit_wait_strategy_with_poll_interval(
     mut strategy: Box<RsExitWaitStrategy>,
     interval_ns: u64,
 ) -> Box<RsExitWaitStrategy> {
-    strategy.strategy = strategy.strategy.with_poll_interval(Duration::from_nanos(interval_ns));
+    let interval = Duration::from_nanos(interval_ns).max(MIN_POLL_INTERVAL);
+    strategy.strategy = strategy.strategy.with_poll_interval(interval);
+    strategy.poll = strategy.poll.with_interval(interval);
     strategy
 }
 
@@ -26,12 +34,58 @@ pub fn rs_exit_wait_strategy_with_exit_code(
     exit_code: i64,
 ) -> Box<RsExitWaitStrategy> {
     strategy.strategy = strategy.strategy.with_exit_code(exit_code);
+    strategy.exit_code = Some(exit_code);
+    strategy
+}
+
+pub fn rs_exit_wait_strategy_with_poll_backoff(
+    mut strategy: Box<RsExitWaitStrategy>,
+    initial_ns: u64,
+    multiplier: f64,
+    max_ns: u64,
+) -> Box<RsExitWaitStrategy> {
+    let initial = Duration::from_nanos(initial_ns).max(MIN_POLL_INTERVAL);
+    strategy.strategy = strategy.strategy.with_poll_interval(initial);
+    let max = Duration::from_nanos(max_ns);
+    strategy.poll = strategy.poll.with_backoff(initial, multiplier, max);
+    strategy
+}
+
+pub fn rs_exit_wait_strategy_with_poll_jitter(
+    mut strategy: Box<RsExitWaitStrategy>,
+    fraction: f64,
+) -> Box<RsExitWaitStrategy> {
+    strategy.poll = strategy.poll.with_jitter(fraction);
+    strategy
+}
+
+pub fn rs_exit_wait_strategy_with_events(
+    mut strategy: Box<RsExitWaitStrategy>,
+) -> Box<RsExitWaitStrategy> {
+    strategy.events = true;
     strategy
 }
 
 impl RsExitWaitStrategy {
     pub fn new(strategy: ExitWaitStrategy) -> Self {
-        Self { strategy }
+        Self {
+            strategy,
+            poll: PollBackoff::fixed(DEFAULT_POLL_INTERVAL),
+            exit_code: None,
+            events: false,
+        }
+    }
+
+    /// testcontainers only polls on a fixed interval and knows nothing of events.
+    pub fn native_only(&self) -> bool {
+        self.events || !self.poll.is_fixed()
     }
-}
 
+    pub fn native(&self) -> NativeWait {
+        NativeWait::Exit {
+            exit_code: self.exit_code,
+            poll: self.poll,
+            events: self.events,
+        }
+    }
+}
@@ -1,8 +1,13 @@
+use crate::core::wait::native_wait::{
+    NativeWait, PollBackoff, DEFAULT_POLL_INTERVAL, MIN_POLL_INTERVAL,
+};
 use testcontainers::core::wait::HealthWaitStrategy;
 use std::time::Duration;
 
 pub struct RsHealthWaitStrategy {
     pub strategy: HealthWaitStrategy,
+    poll: PollBackoff,
+    pub events: bool,
 }
 
 pub fn rs_health_wait_strategy_destroy(strategy: Box<RsHealthWaitStrategy>) {
@@ -17,13 +22,59 @@ pub fn rs_health_wait_strategy_with_poll_interval(
     mut strategy: Box<RsHealthWaitStrategy>,
     interval_ns: u64,
 ) -> Box<RsHealthWaitStrategy> {
-    strategy.strategy = strategy.strategy.with_poll_interval(Duration::from_nanos(interval_ns));
+    let interval = Duration::from_nanos(interval_ns).max(MIN_POLL_INTERVAL);
+    strategy.strategy = strategy.strategy.with_poll_interval(interval);
+    strategy.poll = strategy.poll.with_interval(interval);
+    strategy
+}
+
+pub fn rs_health_wait_strategy_with_poll_backoff(
+    mut strategy: Box<RsHealthWaitStrategy>,
+    initial_ns: u64,
+    multiplier: f64,
+    max_ns: u64,
+) -> Box<RsHealthWaitStrategy> {
+    let initial = Duration::from_nanos(initial_ns).max(MIN_POLL_INTERVAL);
+    // Only used by testcontainers when the multiplier is one, else the wait runs natively
+    strategy.strategy = strategy.strategy.with_poll_interval(initial);
+    let max = Duration::from_nanos(max_ns);
+    strategy.poll = strategy.poll.with_backoff(initial, multiplier, max);
+    strategy
+}
+
+pub fn rs_health_wait_strategy_with_poll_jitter(
+    mut strategy: Box<RsHealthWaitStrategy>,
+    fraction: f64,
+) -> Box<RsHealthWaitStrategy> {
+    strategy.poll = strategy.poll.with_jitter(fraction);
+    strategy
+}
+
+pub fn rs_health_wait_strategy_with_events(
+    mut strategy: Box<RsHealthWaitStrategy>,
+) -> Box<RsHealthWaitStrategy> {
+    strategy.events = true;
     strategy
 }
 
 impl RsHealthWaitStrategy {
     pub fn new(strategy: HealthWaitStrategy) -> Self {
-        Self { strategy }
+        Self {
+            strategy,
+            poll: PollBackoff::fixed(DEFAULT_POLL_INTERVAL),
+            events: false,
+        }
+    }
+
+    /// testcontainers only polls on a fixed interval and knows nothing of events.
+    pub fn native_only(&self) -> bool {
+        self.events || !self.poll.is_fixed()
     }
-}
 
+    pub fn native(&self) -> NativeWait {
+        NativeWait::Healthcheck {
+            poll: self.poll,
+            events: self.events,
+        }
+    }
+}
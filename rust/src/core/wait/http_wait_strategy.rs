@@ -0,0 +1,120 @@
+use crate::{
+    core::container_port::RsContainerPort,
+    core::wait::native_wait::{HttpWait, NativeWait, DEFAULT_POLL_INTERVAL},
+    ffi::HttpBodyMatcher,
+};
+use cxx::UniquePtr;
+use std::sync::Arc;
+use std::time::Duration;
+use testcontainers::core::wait::HttpWaitStrategy;
+
+// The C++ side wraps a std::function that callers are told must be thread safe, a WaitFor
+// copied into several requests polls the same matcher from several containers
+unsafe impl Send for HttpBodyMatcher {}
+unsafe impl Sync for HttpBodyMatcher {}
+
+pub struct RsHttpWaitStrategy {
+    strategy: HttpWaitStrategy,
+    // Same settings, kept for the native check used when the condition is combined
+    wait: HttpWait,
+    tls: bool,
+}
+
+pub fn rs_http_wait_strategy_destroy(strategy: Box<RsHttpWaitStrategy>) {
+    drop(strategy);
+}
+
+pub fn rs_http_wait_strategy_new(path: String) -> Box<RsHttpWaitStrategy> {
+    Box::new(RsHttpWaitStrategy::new(path))
+}
+
+pub fn rs_http_wait_strategy_with_port(
+    mut strategy: Box<RsHttpWaitStrategy>,
+    port: Box<RsContainerPort>,
+) -> Box<RsHttpWaitStrategy> {
+    let port = (*port).into();
+    strategy.strategy = strategy.strategy.with_port(port);
+    strategy.wait.port = Some(port);
+    strategy
+}
+
+pub fn rs_http_wait_strategy_with_expected_status_code(
+    mut strategy: Box<RsHttpWaitStrategy>,
+    status: u16,
+) -> Box<RsHttpWaitStrategy> {
+    strategy.wait.expected_status = Some(status);
+    strategy
+}
+
+pub fn rs_http_wait_strategy_with_body_matcher(
+    mut strategy: Box<RsHttpWaitStrategy>,
+    matcher: UniquePtr<HttpBodyMatcher>,
+) -> Box<RsHttpWaitStrategy> {
+    strategy.wait.body_matcher = Some(Arc::new(matcher));
+    strategy
+}
+
+pub fn rs_http_wait_strategy_with_poll_interval(
+    mut strategy: Box<RsHttpWaitStrategy>,
+    interval_ns: u64,
+) -> Box<RsHttpWaitStrategy> {
+    let interval = Duration::from_nanos(interval_ns);
+    strategy.strategy = strategy.strategy.with_poll_interval(interval);
+    strategy.wait.poll_interval = interval;
+    strategy
+}
+
+pub fn rs_http_wait_strategy_with_tls(
+    mut strategy: Box<RsHttpWaitStrategy>,
+) -> Box<RsHttpWaitStrategy> {
+    strategy.strategy = strategy.strategy.with_tls();
+    strategy.tls = true;
+    strategy
+}
+
+impl RsHttpWaitStrategy {
+    pub fn new(path: String) -> Self {
+        Self {
+            strategy: HttpWaitStrategy::new(path.clone()),
+            wait: HttpWait {
+                path,
+                port: None,
+                expected_status: None,
+                body_matcher: None,
+                poll_interval: DEFAULT_POLL_INTERVAL,
+            },
+            tls: false,
+        }
+    }
+
+    /// The native check speaks plain HTTP only, TLS endpoints have no native form.
+    pub fn native(&self) -> Option<NativeWait> {
+        (!self.tls).then(|| NativeWait::Http(self.wait.clone()))
+    }
+
+    /// Builds the upstream strategy with one matcher covering both the status and the body.
+    ///
+    /// testcontainers keeps a single response matcher and with_expected_status_code replaces
+    /// it, so both checks are folded into one here.
+    pub fn into_strategy(self) -> HttpWaitStrategy {
+        let Self { strategy, wait, .. } = self;
+        if wait.expected_status.is_none() && wait.body_matcher.is_none() {
+            return strategy;
+        }
+
+        let wait = Arc::new(wait);
+        strategy.with_response_matcher_async(move |response| {
+            let wait = wait.clone();
+            async move {
+                let status = response.status().as_u16();
+                if wait.body_matcher.is_none() {
+                    return wait.matches(status, &[]);
+                }
+                match response.bytes().await {
+                    Ok(body) => wait.matches(status, &body),
+                    Err(_) => false,
+                }
+            }
+        })
+    }
+}
@@ -1,8 +1,12 @@
+use crate::core::wait::native_wait::{LogPattern, LogSource, LogWait};
+use regex::bytes::RegexSet;
 use testcontainers::core::wait::LogWaitStrategy;
 
 /// Rust wrapper for LogWaitStrategy
 pub struct RsLogWaitStrategy {
-    pub strategy: LogWaitStrategy,
+    /// None for regex patterns, testcontainers only matches literal messages
+    pub strategy: Option<LogWaitStrategy>,
+    pub wait: LogWait,
 }
 
 /// Destroy LogWaitStrategy instance
@@ -12,17 +16,50 @@ pub fn rs_log_wait_strategy_destroy(strategy: Box<RsLogWaitStrategy>) {
 
 /// Create LogWaitStrategy that waits for message in stdout
 pub fn rs_log_wait_strategy_stdout(message: String) -> Box<RsLogWaitStrategy> {
-    Box::new(RsLogWaitStrategy::new(LogWaitStrategy::stdout(message)))
+    Box::new(RsLogWaitStrategy::new(
+        LogWaitStrategy::stdout(message.clone()),
+        LogSource::StdOut,
+        message,
+    ))
 }
 
 /// Create LogWaitStrategy that waits for message in stderr
 pub fn rs_log_wait_strategy_stderr(message: String) -> Box<RsLogWaitStrategy> {
-    Box::new(RsLogWaitStrategy::new(LogWaitStrategy::stderr(message)))
+    Box::new(RsLogWaitStrategy::new(
+        LogWaitStrategy::stderr(message.clone()),
+        LogSource::StdErr,
+        message,
+    ))
 }
 
 /// Create LogWaitStrategy that waits for message in either stdout or stderr
 pub fn rs_log_wait_strategy_stdout_or_stderr(message: String) -> Box<RsLogWaitStrategy> {
-    Box::new(RsLogWaitStrategy::new(LogWaitStrategy::stdout_or_stderr(message)))
+    Box::new(RsLogWaitStrategy::new(
+        LogWaitStrategy::stdout_or_stderr(message.clone()),
+        LogSource::Either,
+        message,
+    ))
+}
+
+/// Create LogWaitStrategy that waits for a stdout line matching any of the patterns
+pub fn rs_log_wait_strategy_stdout_regex(
+    patterns: Vec<String>,
+) -> Result<Box<RsLogWaitStrategy>, String> {
+    RsLogWaitStrategy::regex(LogSource::StdOut, patterns).map(Box::new)
+}
+
+/// Create LogWaitStrategy that waits for a stderr line matching any of the patterns
+pub fn rs_log_wait_strategy_stderr_regex(
+    patterns: Vec<String>,
+) -> Result<Box<RsLogWaitStrategy>, String> {
+    RsLogWaitStrategy::regex(LogSource::StdErr, patterns).map(Box::new)
+}
+
+/// Create LogWaitStrategy that waits for a line in either stream matching any of the patterns
+pub fn rs_log_wait_strategy_stdout_or_stderr_regex(
+    patterns: Vec<String>,
+) -> Result<Box<RsLogWaitStrategy>, String> {
+    RsLogWaitStrategy::regex(LogSource::Either, patterns).map(Box::new)
 }
 
 /// Set the number of times the message should appear
@@ -30,13 +67,35 @@ pub fn rs_log_wait_strategy_with_times(
     mut strategy: Box<RsLogWaitStrategy>,
     times: usize,
 ) -> Box<RsLogWaitStrategy> {
-    strategy.strategy = strategy.strategy.clone().with_times(times);
+    strategy.strategy = strategy.strategy.take().map(|s| s.with_times(times));
+    strategy.wait.times = times;
     strategy
 }
 
 impl RsLogWaitStrategy {
-    pub fn new(strategy: LogWaitStrategy) -> Self {
-        Self { strategy }
+    pub fn new(strategy: LogWaitStrategy, source: LogSource, message: String) -> Self {
+        Self {
+            strategy: Some(strategy),
+            wait: LogWait {
+                source,
+                pattern: LogPattern::Message(message.into_bytes()),
+                times: 1,
+            },
+        }
     }
-}
 
+    pub fn regex(source: LogSource, patterns: Vec<String>) -> Result<Self, String> {
+        if patterns.is_empty() {
+            return Err("Log regex wait needs at least one pattern".to_string());
+        }
+        let set = RegexSet::new(&patterns).map_err(|e| format!("Invalid log pattern: {}", e))?;
+        Ok(Self {
+            strategy: None,
+            wait: LogWait {
+                source,
+                pattern: LogPattern::Regex(set),
+                times: 1,
+            },
+        })
+    }
+}
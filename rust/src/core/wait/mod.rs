@@ -2,3 +2,5 @@ pub mod wait_for;
 pub mod log_wait_strategy;
 pub mod health_wait_strategy;
 pub mod exit_wait_strategy;
+pub mod native_wait;
+pub mod http_wait_strategy;
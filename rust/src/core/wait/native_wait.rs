@@ -0,0 +1,734 @@
+use crate::{docker::docker, ffi::HttpBodyMatcher};
+use bollard::{
+    container::{InspectContainerOptions, LogOutput, LogsOptions},
+    models::{ContainerState, ContainerStateStatusEnum, EventMessage, HealthStatusEnum},
+    system::EventsOptions,
+};
+use cxx::UniquePtr;
+use futures::{
+    future::{self, BoxFuture},
+    stream::BoxStream,
+    FutureExt, StreamExt,
+};
+use regex::bytes::RegexSet;
+use std::collections::hash_map::RandomState;
+use std::collections::HashMap;
+use std::fmt;
+use std::hash::{BuildHasher, Hasher};
+use std::sync::Arc;
+use std::time::{Duration, SystemTime, UNIX_EPOCH};
+use testcontainers::{
+    core::{CmdWaitFor, ContainerPort, ExecCommand},
+    ContainerAsync, GenericImage, Image,
+};
+use tokio::{
+    io::{AsyncReadExt, AsyncWriteExt},
+    net::TcpStream,
+    time::Instant,
+};
+
+/// Same default testcontainers applies to its own ready conditions.
+pub const DEFAULT_STARTUP_TIMEOUT: Duration = Duration::from_secs(60);
+/// Same default testcontainers uses for its polling strategies.
+pub const DEFAULT_POLL_INTERVAL: Duration = Duration::from_millis(100);
+/// Longest a single HTTP wait request may take, connect to end of body.
+const HTTP_ATTEMPT_TIMEOUT: Duration = Duration::from_secs(2);
+/// How far back event subscriptions start, see StateTicker::new().
+const EVENTS_REPLAY_MARGIN: Duration = Duration::from_secs(1);
+/// Shortest pause between two polls. A zero pause would inspect the daemon back to back.
+pub const MIN_POLL_INTERVAL: Duration = Duration::from_millis(1);
+
+const INITIAL_BACKOFF: Duration = Duration::from_millis(10);
+const MAX_BACKOFF: Duration = Duration::from_millis(500);
+/// Longest unterminated line kept between log chunks for regex matching, older bytes are dropped.
+const MAX_LINE_WINDOW: usize = 64 * 1024;
+
+/// Ready condition checked by us once testcontainers has started the container.
+///
+/// testcontainers::core::WaitFor is a closed enum and its strategies can only be run by
+/// testcontainers itself, one after another. Conditions it cannot express, and our own
+/// equivalents of the ones it can, live here so they can also be combined and run concurrently.
+#[derive(Clone)]
+pub enum NativeWait {
+    Nothing,
+    Duration(Duration),
+    /// A TCP connect to the mapped host port succeeds.
+    ListeningPort { port: ContainerPort, timeout: Duration },
+    Log(LogWait),
+    /// With events set, docker events wake the poll loop early.
+    Healthcheck { poll: PollBackoff, events: bool },
+    Exit { exit_code: Option<i64>, poll: PollBackoff, events: bool },
+    Http(HttpWait),
+    /// Every condition holds, checked concurrently.
+    AllOf(Vec<NativeWait>),
+    /// The first condition to hold wins, the others are cancelled.
+    AnyOf(Vec<NativeWait>),
+}
+
+#[derive(Clone, Copy, PartialEq, Eq)]
+pub enum LogSource {
+    StdOut,
+    StdErr,
+    Either,
+}
+
+#[derive(Clone)]
+pub struct LogWait {
+    pub source: LogSource,
+    pub pattern: LogPattern,
+    pub times: usize,
+}
+
+#[derive(Clone)]
+pub enum LogPattern {
+    /// Literal bytes, found anywhere in the stream and counted per occurrence.
+    Message(Vec<u8>),
+    /// Matched line by line, a line matching any of the expressions counts once.
+    Regex(RegexSet),
+}
+
+/// Pause between the inspects of the health and exit waits.
+///
+/// Starts at initial and grows by multiplier after every poll, up to max, so a container that is
+/// ready almost at once is noticed quickly and a slow one is not inspected at a high rate.
+/// Jitter moves each pause by up to that fraction either way, keeping concurrent waits apart.
+#[derive(Clone, Copy)]
+pub struct PollBackoff {
+    initial: Duration,
+    multiplier: f64,
+    max: Duration,
+    jitter: f64,
+}
+
+#[derive(Clone)]
+pub struct HttpWait {
+    pub path: String,
+    pub port: Option<ContainerPort>,
+    pub expected_status: Option<u16>,
+    pub body_matcher: Option<Arc<UniquePtr<HttpBodyMatcher>>>,
+    pub poll_interval: Duration,
+}
+
+impl NativeWait {
+    pub fn wait<'a>(
+        &'a self,
+        container: &'a ContainerAsync<GenericImage>,
+    ) -> BoxFuture<'a, Result<(), String>> {
+        match self {
+            NativeWait::Nothing => future::ready(Ok(())).boxed(),
+            NativeWait::Duration(length) => tokio::time::sleep(*length).map(Ok).boxed(),
+            NativeWait::ListeningPort { port, timeout } => {
+                wait_listening_port(container, *port, *timeout).boxed()
+            }
+            NativeWait::Log(log) => wait_log(container.id(), log).boxed(),
+            NativeWait::Healthcheck { poll, events } => {
+                wait_healthy(container.id(), *poll, *events).boxed()
+            }
+            NativeWait::Exit {
+                exit_code,
+                poll,
+                events,
+            } => wait_exit(container.id(), *exit_code, *poll, *events).boxed(),
+            NativeWait::Http(http) => wait_http(container, http).boxed(),
+            NativeWait::AllOf(conditions) => {
+                future::try_join_all(conditions.iter().map(|c| c.wait(container)))
+                    .map(|result| result.map(|_| ()))
+                    .boxed()
+            }
+            NativeWait::AnyOf(conditions) if conditions.is_empty() => {
+                future::ready(Err("any_of needs at least one condition".to_string())).boxed()
+            }
+            NativeWait::AnyOf(conditions) => {
+                future::select_ok(conditions.iter().map(|c| c.wait(container)))
+                    .map(|result| result.map(|_| ()))
+                    .boxed()
+            }
+        }
+    }
+}
+
+impl PollBackoff {
+    /// Intervals below MIN_POLL_INTERVAL are raised to it, here and in with_backoff().
+    pub fn fixed(interval: Duration) -> Self {
+        let interval = interval.max(MIN_POLL_INTERVAL);
+        Self {
+            initial: interval,
+            multiplier: 1.0,
+            max: interval,
+            jitter: 0.0,
+        }
+    }
+
+    /// Keeps the jitter.
+    pub fn with_interval(self, interval: Duration) -> Self {
+        Self {
+            jitter: self.jitter,
+            ..Self::fixed(interval)
+        }
+    }
+
+    /// Keeps the jitter. A multiplier below one, or not a number, is taken as one; max is at
+    /// least initial.
+    pub fn with_backoff(self, initial: Duration, multiplier: f64, max: Duration) -> Self {
+        let initial = initial.max(MIN_POLL_INTERVAL);
+        Self {
+            initial,
+            multiplier: if multiplier >= 1.0 { multiplier } else { 1.0 },
+            max: max.max(initial),
+            jitter: self.jitter,
+        }
+    }
+
+    /// The fraction is clamped to [0, 1].
+    pub fn with_jitter(self, jitter: f64) -> Self {
+        Self {
+            jitter: if jitter > 0.0 { jitter.min(1.0) } else { 0.0 },
+            ..self
+        }
+    }
+
+    /// testcontainers can only poll on a fixed interval.
+    pub fn is_fixed(&self) -> bool {
+        self.multiplier == 1.0 && self.jitter == 0.0
+    }
+
+    fn next(&self, pause: Duration) -> Duration {
+        Duration::try_from_secs_f64(pause.as_secs_f64() * self.multiplier)
+            .map_or(self.max, |next| next.min(self.max))
+    }
+
+    fn jittered(&self, pause: Duration) -> Duration {
+        if self.jitter == 0.0 {
+            return pause;
+        }
+        // RandomState is seeded randomly, which is all the randomness spreading polls needs
+        let unit = RandomState::new().build_hasher().finish() as f64 / u64::MAX as f64;
+        // A fraction of one can take the whole pause away
+        pause
+            .mul_f64(1.0 + self.jitter * (2.0 * unit - 1.0))
+            .max(MIN_POLL_INTERVAL)
+    }
+}
+
+/// Runs the conditions in order, giving up once timeout, what is left of the startup timeout,
+/// has passed.
+///
+/// Returns how long each condition took to hold.
+pub async fn wait_all(
+    conditions: &[NativeWait],
+    container: &ContainerAsync<GenericImage>,
+    timeout: Duration,
+) -> Result<Vec<Duration>, String> {
+    let all = async {
+        let mut timings = Vec::with_capacity(conditions.len());
+        for condition in conditions {
+            let began = Instant::now();
+            condition.wait(container).await?;
+            timings.push(began.elapsed());
+        }
+        Ok(timings)
+    };
+    tokio::time::timeout(timeout, all)
+        .await
+        .map_err(|_| "Container is not ready within the startup timeout".to_string())?
+}
+
+impl fmt::Display for NativeWait {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        match self {
+            NativeWait::Nothing => f.write_str("nothing"),
+            NativeWait::Duration(length) => write!(f, "duration {:?}", length),
+            NativeWait::ListeningPort { port, .. } => write!(f, "listening port {:?}", port),
+            NativeWait::Log(log) => {
+                let source = match log.source {
+                    LogSource::StdOut => "stdout",
+                    LogSource::StdErr => "stderr",
+                    LogSource::Either => "stdout or stderr",
+                };
+                write!(f, "log {} on {} x{}", log.pattern, source, log.times)
+            }
+            NativeWait::Healthcheck { .. } => f.write_str("healthcheck"),
+            NativeWait::Exit { exit_code, .. } => match exit_code {
+                Some(code) => write!(f, "exit with code {}", code),
+                None => f.write_str("exit"),
+            },
+            NativeWait::Http(http) => write!(f, "http {}", http.path),
+            NativeWait::AllOf(conditions) => write_composite(f, "all_of", conditions),
+            NativeWait::AnyOf(conditions) => write_composite(f, "any_of", conditions),
+        }
+    }
+}
+
+impl fmt::Display for LogPattern {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        match self {
+            LogPattern::Message(message) => write!(f, "{:?}", String::from_utf8_lossy(message)),
+            LogPattern::Regex(set) => {
+                for (i, pattern) in set.patterns().iter().enumerate() {
+                    if i > 0 {
+                        f.write_str(" or ")?;
+                    }
+                    write!(f, "/{}/", pattern)?;
+                }
+                Ok(())
+            }
+        }
+    }
+}
+
+fn write_composite(
+    f: &mut fmt::Formatter<'_>,
+    name: &str,
+    conditions: &[NativeWait],
+) -> fmt::Result {
+    write!(f, "{}(", name)?;
+    for (i, condition) in conditions.iter().enumerate() {
+        if i > 0 {
+            f.write_str(", ")?;
+        }
+        write!(f, "{}", condition)?;
+    }
+    f.write_str(")")
+}
+
+async fn mapped_address(
+    container: &ContainerAsync<GenericImage>,
+    port: ContainerPort,
+) -> Result<(String, u16), String> {
+    let host = container
+        .get_host()
+        .await
+        .map_err(|e| format!("Failed to get host: {}", e))?
+        .to_string();
+    let host_port = container
+        .get_host_port_ipv4(port)
+        .await
+        .map_err(|e| format!("Failed to get host port for {:?}: {}", port, e))?;
+    Ok((host, host_port))
+}
+
+/// Ready once the mapped host port accepts a TCP connection and the port is listening inside the
+/// container. A connect alone proves nothing when a userland proxy holds the host side, but the
+/// inside check needs a shell in the image; where it cannot run, the connect decides alone.
+async fn wait_listening_port(
+    container: &ContainerAsync<GenericImage>,
+    port: ContainerPort,
+    timeout: Duration,
+) -> Result<(), String> {
+    let (host, host_port) = mapped_address(container, port).await?;
+
+    let deadline = Instant::now() + timeout;
+    let mut backoff = INITIAL_BACKOFF;
+    let mut inside_available = true;
+    loop {
+        let remaining = deadline.saturating_duration_since(Instant::now());
+        let probe = async {
+            // Only TCP has a connect to try from the host side
+            let reachable = !matches!(port, ContainerPort::Tcp(_))
+                || TcpStream::connect((host.as_str(), host_port)).await.is_ok();
+            if !reachable || !inside_available {
+                return reachable;
+            }
+            match listening_inside(container, port).await {
+                Some(listening) => listening,
+                None => {
+                    inside_available = false;
+                    true
+                }
+            }
+        };
+        if let Ok(true) = tokio::time::timeout(remaining, probe).await {
+            return Ok(());
+        }
+        if Instant::now() + backoff >= deadline {
+            return Err(format!(
+                "Port {:?} is not listening on {}:{} after {:?}",
+                port, host, host_port, timeout
+            ));
+        }
+        tokio::time::sleep(backoff).await;
+        backoff = (backoff * 2).min(MAX_BACKOFF);
+    }
+}
+
+/// Looks for the port in the kernel socket tables of the container, falling back to nc and to
+/// bash's /dev/tcp for images without /proc access, like HostPortWaitStrategy of Java
+/// testcontainers. None when the check cannot run in the image, e.g. one without a shell.
+async fn listening_inside(
+    container: &ContainerAsync<GenericImage>,
+    port: ContainerPort,
+) -> Option<bool> {
+    let script = match port {
+        ContainerPort::Tcp(port) => format!(
+            "awk '$4 == \"0A\" {{print $2}}' /proc/net/tcp* | grep -i ':0*{port:x}$' \
+             || nc -z -w 1 localhost {port} || bash -c '</dev/tcp/localhost/{port}'",
+            port = port
+        ),
+        // Unbound UDP sockets have no listen state, any entry for the port will do
+        ContainerPort::Udp(port) => format!(
+            "awk '{{print $2}}' /proc/net/udp* | grep -i ':0*{port:x}$'",
+            port = port
+        ),
+        ContainerPort::Sctp(port) => format!(
+            "awk '$6 == {port} {{found = 1}} END {{exit !found}}' /proc/net/sctp/eps",
+            port = port
+        ),
+    };
+    let command = ExecCommand::new(["sh", "-c", script.as_str()])
+        .with_cmd_ready_condition(CmdWaitFor::exit());
+    let mut result = container.exec(command).await.ok()?;
+    match result.exit_code().await.ok()? {
+        Some(0) => Some(true),
+        // The shell or every tool the script tries is missing
+        Some(126) | Some(127) | None => None,
+        Some(_) => Some(false),
+    }
+}
+
+impl LogWait {
+    /// Holds without looking at the logs at all.
+    pub fn holds_at_once(&self) -> bool {
+        let empty_message =
+            matches!(&self.pattern, LogPattern::Message(message) if message.is_empty());
+        empty_message || self.times == 0
+    }
+}
+
+async fn wait_log(container_id: &str, log: &LogWait) -> Result<(), String> {
+    if log.holds_at_once() {
+        return Ok(());
+    }
+
+    let options = LogsOptions::<String> {
+        follow: true,
+        stdout: log.source != LogSource::StdErr,
+        stderr: log.source != LogSource::StdOut,
+        ..Default::default()
+    };
+    let mut logs = docker()?.logs(container_id, Some(options));
+
+    // Frames of both streams interleave, each keeps its own partial line
+    let mut stdout = LogScanner::new(&log.pattern);
+    let mut stderr = LogScanner::new(&log.pattern);
+    let mut seen = 0;
+    while let Some(output) = logs.next().await {
+        let output = output.map_err(|e| format!("Failed to read logs: {}", e))?;
+        seen += match output {
+            LogOutput::StdErr { message } => stderr.feed(&message),
+            output => stdout.feed(&output.into_bytes()),
+        };
+        if seen >= log.times {
+            return Ok(());
+        }
+    }
+    if seen + stdout.finish() + stderr.finish() >= log.times {
+        return Ok(());
+    }
+    Err(format!(
+        "Container logs ended before {} appeared {} time(s)",
+        log.pattern, log.times
+    ))
+}
+
+/// Engine API timestamp of the log entry that made the condition hold, found by matching the
+/// logs written up to until again. None when those logs do not satisfy the condition.
+pub async fn log_satisfied_at(
+    container_id: &str,
+    log: &LogWait,
+    until: SystemTime,
+) -> Result<Option<String>, String> {
+    // The API takes whole seconds; rounding up only adds entries written after the condition held
+    let until = until
+        .duration_since(UNIX_EPOCH)
+        .map_or(0, |until| i64::try_from(until.as_secs()).unwrap_or(i64::MAX - 1) + 1);
+    let options = LogsOptions::<String> {
+        stdout: log.source != LogSource::StdErr,
+        stderr: log.source != LogSource::StdOut,
+        timestamps: true,
+        until,
+        ..Default::default()
+    };
+    let mut logs = docker()?.logs(container_id, Some(options));
+
+    let mut stdout = LogScanner::new(&log.pattern);
+    let mut stderr = LogScanner::new(&log.pattern);
+    let mut seen = 0;
+    while let Some(output) = logs.next().await {
+        let output = output.map_err(|e| format!("Failed to read logs: {}", e))?;
+        let (scanner, entry) = match output {
+            LogOutput::StdErr { message } => (&mut stderr, message),
+            output => (&mut stdout, output.into_bytes()),
+        };
+        // Each entry starts with its timestamp and a space
+        let Some(space) = entry.iter().position(|&b| b == b' ') else {
+            continue;
+        };
+        seen += scanner.feed(&entry[space + 1..]);
+        if seen >= log.times {
+            return Ok(Some(String::from_utf8_lossy(&entry[..space]).into_owned()));
+        }
+    }
+    Ok(None)
+}
+
+/// Matches a log pattern over a stream of chunks without keeping the whole log.
+///
+/// Only a tail is carried from one chunk to the next: for a literal message the bytes that could
+/// start a message split across chunks, for regex patterns the current unterminated line. A line
+/// longer than MAX_LINE_WINDOW is dropped up to its newline rather than matched in part.
+struct LogScanner<'a> {
+    pattern: &'a LogPattern,
+    window: Vec<u8>,
+    // Inside a line that outgrew MAX_LINE_WINDOW, skipped until the next newline
+    overlong: bool,
+}
+
+impl<'a> LogScanner<'a> {
+    fn new(pattern: &'a LogPattern) -> Self {
+        Self {
+            pattern,
+            window: Vec::new(),
+            overlong: false,
+        }
+    }
+
+    /// Appends a chunk, returning how many matches it completed.
+    fn feed(&mut self, mut chunk: &[u8]) -> usize {
+        if self.overlong {
+            let Some(end) = chunk.iter().position(|&b| b == b'\n') else {
+                return 0;
+            };
+            chunk = &chunk[end + 1..];
+            self.overlong = false;
+        }
+        self.window.extend_from_slice(chunk);
+        match self.pattern {
+            LogPattern::Message(message) => {
+                let mut seen = 0;
+                let mut start = 0;
+                while let Some(found) =
+                    self.window[start..].windows(message.len()).position(|w| w == message)
+                {
+                    seen += 1;
+                    start += found + message.len();
+                }
+                let keep_from = start.max(self.window.len().saturating_sub(message.len() - 1));
+                self.window.drain(..keep_from);
+                seen
+            }
+            LogPattern::Regex(set) => {
+                let complete = self
+                    .window
+                    .iter()
+                    .rposition(|&b| b == b'\n')
+                    .map_or(0, |end| end + 1);
+                let seen = self.window[..complete]
+                    .split_inclusive(|&b| b == b'\n')
+                    .filter(|line| set.is_match(trim_line(line)))
+                    .count();
+                self.window.drain(..complete);
+                if self.window.len() > MAX_LINE_WINDOW {
+                    self.window.clear();
+                    self.overlong = true;
+                }
+                seen
+            }
+        }
+    }
+
+    /// Matches the last line once the stream has ended without a trailing newline.
+    fn finish(&mut self) -> usize {
+        match self.pattern {
+            LogPattern::Regex(set) if !self.overlong && !self.window.is_empty() => {
+                usize::from(set.is_match(trim_line(&self.window)))
+            }
+            _ => 0,
+        }
+    }
+}
+
+fn trim_line(line: &[u8]) -> &[u8] {
+    let line = line.strip_suffix(b"\n").unwrap_or(line);
+    line.strip_suffix(b"\r").unwrap_or(line)
+}
+
+async fn inspect_state(container_id: &str) -> Result<ContainerState, String> {
+    docker()?
+        .inspect_container(container_id, None::<InspectContainerOptions>)
+        .await
+        .map_err(|e| format!("Failed to inspect container: {}", e))?
+        .state
+        .ok_or_else(|| "Container inspect returned no state".to_string())
+}
+
+/// Paces the inspect loops of the health and exit waits.
+///
+/// When subscribed, an event for the container ends the pause early. The poll interval stays
+/// as the fallback for events the daemon drops or filters differently.
+struct StateTicker {
+    poll: PollBackoff,
+    pause: Duration,
+    events: Option<BoxStream<'static, Result<EventMessage, bollard::errors::Error>>>,
+}
+
+impl StateTicker {
+    /// Must be created before the first inspect. The events stream only connects when first
+    /// polled, so the subscription asks the daemon to replay events from EVENTS_REPLAY_MARGIN
+    /// before this call on, which covers anything that happens between the inspect and the first
+    /// tick.
+    fn new(container_id: &str, poll: PollBackoff, events: &[&str]) -> Result<Self, String> {
+        let events = if events.is_empty() {
+            None
+        } else {
+            let filters = HashMap::from([
+                ("container".to_string(), vec![container_id.to_string()]),
+                ("event".to_string(), events.iter().map(|e| e.to_string()).collect()),
+            ]);
+            // Backdated by EVENTS_REPLAY_MARGIN against clock skew with the daemon; replayed
+            // events only cost an extra inspect
+            let since = SystemTime::now()
+                .checked_sub(EVENTS_REPLAY_MARGIN)
+                .and_then(|since| since.duration_since(UNIX_EPOCH).ok())
+                .map(|since| format!("{}.{:09}", since.as_secs(), since.subsec_nanos()));
+            let options = EventsOptions::<String> {
+                since,
+                filters,
+                ..Default::default()
+            };
+            Some(docker()?.events(Some(options)).boxed())
+        };
+        Ok(Self {
+            poll,
+            pause: poll.initial,
+            events,
+        })
+    }
+
+    async fn tick(&mut self) {
+        let pause = self.poll.jittered(self.pause);
+        self.pause = self.poll.next(self.pause);
+        let Some(events) = self.events.as_mut() else {
+            tokio::time::sleep(pause).await;
+            return;
+        };
+        tokio::select! {
+            event = events.next() => {
+                if !matches!(event, Some(Ok(_))) {
+                    // The stream is gone, keep polling on the interval alone
+                    self.events = None;
+                }
+            }
+            _ = tokio::time::sleep(pause) => {}
+        }
+    }
+}
+
+async fn wait_healthy(container_id: &str, poll: PollBackoff, events: bool) -> Result<(), String> {
+    let subscribe: &[&str] = if events { &["health_status", "die"] } else { &[] };
+    let mut ticker = StateTicker::new(container_id, poll, subscribe)?;
+    loop {
+        let state = inspect_state(container_id).await?;
+        if state.status == Some(ContainerStateStatusEnum::EXITED) {
+            return Err("Container exited before becoming healthy".to_string());
+        }
+        match state.health.and_then(|h| h.status) {
+            Some(HealthStatusEnum::HEALTHY) => return Ok(()),
+            Some(HealthStatusEnum::UNHEALTHY) => {
+                return Err("Container healthcheck reported unhealthy".to_string())
+            }
+            Some(HealthStatusEnum::STARTING) => ticker.tick().await,
+            _ => return Err("Container has no healthcheck configured".to_string()),
+        }
+    }
+}
+
+async fn wait_exit(
+    container_id: &str,
+    exit_code: Option<i64>,
+    poll: PollBackoff,
+    events: bool,
+) -> Result<(), String> {
+    let subscribe: &[&str] = if events { &["die"] } else { &[] };
+    let mut ticker = StateTicker::new(container_id, poll, subscribe)?;
+    loop {
+        let state = inspect_state(container_id).await?;
+        if state.status == Some(ContainerStateStatusEnum::EXITED) {
+            return match (exit_code, state.exit_code) {
+                (Some(expected), Some(actual)) if expected != actual => Err(format!(
+                    "Container exited with code {}, expected {}",
+                    actual, expected
+                )),
+                _ => Ok(()),
+            };
+        }
+        ticker.tick().await;
+    }
+}
+
+async fn wait_http(
+    container: &ContainerAsync<GenericImage>,
+    http: &HttpWait,
+) -> Result<(), String> {
+    let port = match http.port {
+        Some(port) => port,
+        None => *container
+            .image()
+            .expose_ports()
+            .first()
+            .ok_or_else(|| "Http wait needs a port, the image exposes none".to_string())?,
+    };
+    let (host, host_port) = mapped_address(container, port).await?;
+
+    loop {
+        // A server that accepts but never answers must not stall the wait, the next attempt may
+        let request = http_get(&host, host_port, &http.path);
+        if let Ok(Ok((status, body))) = tokio::time::timeout(HTTP_ATTEMPT_TIMEOUT, request).await {
+            if http.matches(status, &body) {
+                return Ok(());
+            }
+        }
+        tokio::time::sleep(http.poll_interval).await;
+    }
+}
+
+/// Plain HTTP/1.0 GET, so the body arrives unchunked and the connection closes after it.
+async fn http_get(host: &str, port: u16, path: &str) -> std::io::Result<(u16, Vec<u8>)> {
+    let mut stream = TcpStream::connect((host, port)).await?;
+    let request = format!(
+        "GET {} HTTP/1.0\r\nHost: {}:{}\r\nConnection: close\r\n\r\n",
+        path, host, port
+    );
+    stream.write_all(request.as_bytes()).await?;
+
+    let mut response = Vec::new();
+    stream.read_to_end(&mut response).await?;
+
+    let invalid = || std::io::Error::new(std::io::ErrorKind::InvalidData, "malformed response");
+    let head_end = response
+        .windows(4)
+        .position(|w| w == b"\r\n\r\n")
+        .ok_or_else(invalid)?;
+    let status = std::str::from_utf8(&response[..head_end])
+        .ok()
+        .and_then(|head| head.split_whitespace().nth(1))
+        .and_then(|code| code.parse().ok())
+        .ok_or_else(invalid)?;
+    Ok((status, response.split_off(head_end + 4)))
+}
+
+impl HttpWait {
+    pub fn matches(&self, status: u16, body: &[u8]) -> bool {
+        let status_matches = match self.expected_status {
+            Some(expected) => status == expected,
+            None => (200..300).contains(&status),
+        };
+        if !status_matches {
+            return false;
+        }
+        match self.body_matcher.as_deref().and_then(UniquePtr::as_ref) {
+            // Err is an exception thrown by the matcher, the next poll tries again
+            Some(matcher) => matcher.matches(body).unwrap_or(false),
+            None => true,
+        }
+    }
+}
@@ -1,12 +1,18 @@
-use crate::core::wait::{
+use crate::core::{container_port::RsContainerPort, wait::{
     exit_wait_strategy::RsExitWaitStrategy, health_wait_strategy::RsHealthWaitStrategy,
-    log_wait_strategy::RsLogWaitStrategy,
-};
+    http_wait_strategy::RsHttpWaitStrategy, log_wait_strategy::RsLogWaitStrategy,
+    native_wait::NativeWait,
+}};
 use std::time::Duration;
 use testcontainers::core::WaitFor;
 
+#[derive(Clone)]
 pub struct RsWaitFor {
     pub strategy: WaitFor,
+    // Our own form of the condition, used when it is combined with others
+    pub native: Option<NativeWait>,
+    // Set when testcontainers cannot run the condition, strategy is then WaitFor::Nothing
+    pub native_only: bool,
 }
 
 pub fn rs_wait_for_nothing() -> Box<RsWaitFor> {
@@ -14,7 +20,14 @@ pub fn rs_wait_for_nothing() -> Box<RsWaitFor> {
 }
 
 pub fn rs_wait_for_log(strategy: Box<RsLogWaitStrategy>) -> Box<RsWaitFor> {
-    Box::new(RsWaitFor::new(WaitFor::Log(strategy.strategy)))
+    let RsLogWaitStrategy { strategy, wait } = *strategy;
+    match strategy {
+        Some(strategy) => {
+            Box::new(RsWaitFor::with_native(WaitFor::Log(strategy), NativeWait::Log(wait)))
+        }
+        // Regex patterns are beyond testcontainers, they are matched natively after start
+        None => Box::new(RsWaitFor::native(NativeWait::Log(wait))),
+    }
 }
 
 pub fn rs_wait_for_duration(duration_ns: u64) -> Box<RsWaitFor> {
@@ -24,17 +37,85 @@ pub fn rs_wait_for_duration(duration_ns: u64) -> Box<RsWaitFor> {
 }
 
 pub fn rs_wait_for_healthcheck(strategy: Box<RsHealthWaitStrategy>) -> Box<RsWaitFor> {
-    Box::new(RsWaitFor::new(WaitFor::Healthcheck(strategy.strategy)))
+    let native = strategy.native();
+    if strategy.native_only() {
+        // Event-driven and backoff waits are beyond testcontainers, they run natively after start
+        return Box::new(RsWaitFor::native(native));
+    }
+    Box::new(RsWaitFor::with_native(WaitFor::Healthcheck(strategy.strategy), native))
 }
 
 pub fn rs_wait_for_exit(strategy: Box<RsExitWaitStrategy>) -> Box<RsWaitFor> {
-    Box::new(RsWaitFor::new(WaitFor::Exit(strategy.strategy)))
+    let native = strategy.native();
+    if strategy.native_only() {
+        return Box::new(RsWaitFor::native(native));
+    }
+    Box::new(RsWaitFor::with_native(WaitFor::Exit(strategy.strategy), native))
+}
+
+pub fn rs_wait_for_http(strategy: Box<RsHttpWaitStrategy>) -> Box<RsWaitFor> {
+    let native = strategy.native();
+    let mut wait_for = RsWaitFor::new(WaitFor::http(strategy.into_strategy()));
+    wait_for.native = native;
+    Box::new(wait_for)
 }
 
 pub fn rs_wait_for_millis_in_env_var(name: &'static str) -> Box<RsWaitFor> {
     Box::new(RsWaitFor::new(WaitFor::millis_in_env_var(name)))
 }
 
+pub fn rs_wait_for_listening_port(port: Box<RsContainerPort>, timeout_ns: u64) -> Box<RsWaitFor> {
+    Box::new(RsWaitFor::native(NativeWait::ListeningPort {
+        port: (*port).into(),
+        timeout: Duration::from_nanos(timeout_ns),
+    }))
+}
+
+pub fn rs_wait_for_all_of(conditions: Vec<RsWaitFor>) -> Result<Box<RsWaitFor>, String> {
+    Ok(Box::new(RsWaitFor::native(NativeWait::AllOf(natives_of(conditions)?))))
+}
+
+pub fn rs_wait_for_any_of(conditions: Vec<RsWaitFor>) -> Result<Box<RsWaitFor>, String> {
+    if conditions.is_empty() {
+        return Err("any_of needs at least one condition".to_string());
+    }
+    Ok(Box::new(RsWaitFor::native(NativeWait::AnyOf(natives_of(conditions)?))))
+}
+
+fn natives_of(conditions: Vec<RsWaitFor>) -> Result<Vec<NativeWait>, String> {
+    conditions
+        .into_iter()
+        .map(|condition| {
+            let strategy = condition.strategy;
+            condition
+                .native
+                .ok_or_else(|| format!("{:?} cannot be combined with other conditions", strategy))
+        })
+        .collect()
+}
+
+/// Conditions handed to testcontainers, the native-only ones are checked by us after start.
+pub fn upstream_conditions(conditions: &[RsWaitFor]) -> Vec<WaitFor> {
+    conditions
+        .iter()
+        .filter(|condition| !condition.native_only)
+        .map(|condition| condition.strategy.clone())
+        .collect()
+}
+
+/// Separates conditions testcontainers can run from the ones checked after start.
+pub fn split_conditions(conditions: Vec<RsWaitFor>) -> (Vec<WaitFor>, Vec<NativeWait>) {
+    let mut strategies = Vec::with_capacity(conditions.len());
+    let mut natives = Vec::new();
+    for condition in conditions {
+        match condition.native {
+            Some(native) if condition.native_only => natives.push(native),
+            _ => strategies.push(condition.strategy),
+        }
+    }
+    (strategies, natives)
+}
+
 // vec helpers
 pub fn rs_wait_for_vec_push(vec: &mut Vec<RsWaitFor>, wait_for: Box<RsWaitFor>) {
     vec.push(*wait_for);
@@ -51,11 +132,37 @@ pub fn rs_wait_for_destroy(wait_for: Box<RsWaitFor>) {
 }
 
 impl RsWaitFor {
+    /// Conditions without settings hidden inside an upstream strategy get their native form here.
     pub fn new(strategy: WaitFor) -> Self {
-        Self { strategy }
+        let native = match &strategy {
+            WaitFor::Nothing => Some(NativeWait::Nothing),
+            WaitFor::Duration { length } => Some(NativeWait::Duration(*length)),
+            _ => None,
+        };
+        Self {
+            strategy,
+            native,
+            native_only: false,
+        }
+    }
+
+    pub fn with_native(strategy: WaitFor, native: NativeWait) -> Self {
+        Self {
+            strategy,
+            native: Some(native),
+            native_only: false,
+        }
+    }
+
+    pub fn native(native: NativeWait) -> Self {
+        Self {
+            strategy: WaitFor::Nothing,
+            native: Some(native),
+            native_only: true,
+        }
     }
 
     pub fn rs_wait_for_clone(self: &RsWaitFor) -> Box<RsWaitFor> {
-        Box::new(RsWaitFor::new(self.strategy.clone()))
+        Box::new(self.clone())
     }
 }
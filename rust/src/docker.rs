@@ -0,0 +1,92 @@
+use crate::runtime::runtime;
+use bollard::{Docker, API_DEFAULT_VERSION};
+use std::{
+    env, fs,
+    path::{Path, PathBuf},
+    sync::OnceLock,
+};
+
+static DOCKER: OnceLock<Docker> = OnceLock::new();
+
+/// Same request timeout bollard applies to its default connections, in seconds.
+const TIMEOUT_SECS: u64 = 120;
+const DEFAULT_SOCKET: &str = "/var/run/docker.sock";
+
+/// Docker Engine API client for operations testcontainers-rs does not expose.
+///
+/// Talks to the same daemon testcontainers-rs does, see docker_host(). A failed connect is not
+/// kept, the next call tries again.
+pub fn docker() -> Result<&'static Docker, String> {
+    if let Some(docker) = DOCKER.get() {
+        return Ok(docker);
+    }
+    let docker = {
+        let _guard = runtime().enter();
+        connect().map_err(|e| format!("Failed to connect to Docker: {}", e))?
+    };
+    Ok(DOCKER.get_or_init(|| docker))
+}
+
+fn connect() -> Result<Docker, bollard::errors::Error> {
+    let Some(host) = docker_host() else {
+        // DOCKER_HOST, with its TLS settings, or the default socket
+        return Docker::connect_with_defaults();
+    };
+    match host.split_once("://") {
+        Some(("unix" | "npipe", path)) => {
+            Docker::connect_with_socket(path, TIMEOUT_SECS, API_DEFAULT_VERSION)
+        }
+        _ => Docker::connect_with_http(&host, TIMEOUT_SECS, API_DEFAULT_VERSION),
+    }
+}
+
+/// Host of the daemon in the order testcontainers-rs resolves it: tc.host from
+/// ~/.testcontainers.properties, DOCKER_HOST, docker.host from the properties, the default
+/// socket, then the rootless and Docker Desktop sockets. None where bollard's defaults pick
+/// the same daemon.
+fn docker_host() -> Option<String> {
+    let properties = home_dir()
+        .and_then(|home| fs::read_to_string(home.join(".testcontainers.properties")).ok())
+        .unwrap_or_default();
+    if let Some(host) = property(&properties, "tc.host") {
+        return Some(host);
+    }
+    if env::var_os("DOCKER_HOST").is_some() {
+        return None;
+    }
+    if let Some(host) = property(&properties, "docker.host") {
+        return Some(host);
+    }
+    if Path::new(DEFAULT_SOCKET).exists() {
+        return None;
+    }
+    let runtime_dir = env::var_os("XDG_RUNTIME_DIR").map(PathBuf::from);
+    let home = home_dir();
+    [
+        runtime_dir.map(|dir| dir.join(".docker/run/docker.sock")),
+        home.as_ref().map(|home| home.join(".docker/run/docker.sock")),
+        home.as_ref().map(|home| home.join(".docker/desktop/docker.sock")),
+    ]
+    .into_iter()
+    .flatten()
+    .find(|socket| socket.exists())
+    .map(|socket| format!("unix://{}", socket.display()))
+}
+
+/// Value of a key=value line of a Java properties file, as testcontainers-rs reads it.
+fn property(properties: &str, key: &str) -> Option<String> {
+    properties
+        .lines()
+        .map(str::trim)
+        .filter(|line| !line.starts_with('#') && !line.starts_with('!'))
+        .filter_map(|line| line.split_once('='))
+        .find(|(name, _)| name.trim() == key)
+        .map(|(_, value)| value.trim().to_string())
+        .filter(|value| !value.is_empty())
+}
+
+fn home_dir() -> Option<PathBuf> {
+    env::var_os("HOME")
+        .or_else(|| env::var_os("USERPROFILE"))
+        .map(PathBuf::from)
+}
@@ -1,14 +1,20 @@
 use crate::{
+    async_task::{RsAsyncOutput, RsAsyncTask},
     container::RsContainer, container_request::RsContainerRequest,
     core::cgroupns_mode::RsCgroupnsMode, core::container_port::RsContainerPort,
     core::copy_data_source::RsCopyDataSource, core::healthcheck::RsHealthcheck, core::host::RsHost,
-    core::mount::RsMount, core::wait::wait_for::RsWaitFor,
+    core::log_consumer::RsLogConsumer, core::mount::RsMount,
+    core::reuse_directive::RsReuseDirective,
+    core::wait::wait_for::{upstream_conditions, RsWaitFor}, ffi::LogConsumerCallback,
+    runtime::runtime,
 };
+use cxx::UniquePtr;
 use std::time::Duration;
-use testcontainers::{runners::SyncRunner, GenericImage, Image, ImageExt};
+use testcontainers::{ContainerRequest, GenericImage, Image, ImageExt};
 
 pub struct RsGenericImage {
     image: GenericImage,
+    ready_conditions: Vec<RsWaitFor>,
 }
 
 pub fn rs_generic_image_new(name: String, tag: String) -> Box<RsGenericImage> {
@@ -19,91 +25,113 @@ pub fn rs_generic_image_destroy(image: Box<RsGenericImage>) {
     drop(image);
 }
 
+pub fn rs_generic_image_clone(image: &RsGenericImage) -> Box<RsGenericImage> {
+    Box::new(RsGenericImage {
+        image: image.image.clone(),
+        ready_conditions: image.ready_conditions.clone(),
+    })
+}
+
 pub fn rs_generic_image_with_exposed_port(
     image: Box<RsGenericImage>,
     port: Box<RsContainerPort>,
 ) -> Box<RsGenericImage> {
-    Box::new(RsGenericImage::new(
-        image.image.with_exposed_port((*port).into()),
-    ))
+    image.map(|image| image.with_exposed_port((*port).into()))
 }
 
 pub fn rs_generic_image_with_entrypoint(
     image: Box<RsGenericImage>,
     entrypoint: &str,
 ) -> Box<RsGenericImage> {
-    Box::new(RsGenericImage::new(image.image.with_entrypoint(entrypoint)))
+    image.map(|image| image.with_entrypoint(entrypoint))
 }
 
 pub fn rs_generic_image_with_wait_for(
-    image: Box<RsGenericImage>,
+    mut image: Box<RsGenericImage>,
     wait_for: Box<RsWaitFor>,
 ) -> Box<RsGenericImage> {
-    Box::new(RsGenericImage::new(
-        image.image.with_wait_for(wait_for.strategy),
-    ))
+    let wait_for = *wait_for;
+    if !wait_for.native_only {
+        image = image.map(|image| image.with_wait_for(wait_for.strategy.clone()));
+    }
+    image.ready_conditions.push(wait_for);
+    image
 }
 
 pub fn rs_generic_image_start(image: Box<RsGenericImage>) -> Result<Box<RsContainer>, String> {
-    let container = image
-        .image
-        .start()
-        .map_err(|e| format!("Failed to start container: {}", e))?;
-    Ok(Box::new(RsContainer::new(container)))
+    Ok(Box::new(runtime().block_on(RsContainerRequest::from(*image).start())?))
+}
+
+pub fn rs_generic_image_start_async(image: Box<RsGenericImage>) -> Box<RsAsyncTask> {
+    RsAsyncTask::spawn(async move {
+        RsContainerRequest::from(*image)
+            .start()
+            .await
+            .map(RsAsyncOutput::Container)
+    })
+}
+
+pub fn rs_generic_image_pull_async(image: Box<RsGenericImage>) -> Box<RsAsyncTask> {
+    RsAsyncTask::spawn(async move {
+        RsContainerRequest::from(*image)
+            .pull()
+            .await
+            .map(RsAsyncOutput::ContainerRequest)
+    })
+}
+
+pub fn rs_generic_image_into_container_request(
+    image: Box<RsGenericImage>,
+) -> Box<RsContainerRequest> {
+    Box::new(RsContainerRequest::from(*image))
 }
 
 pub fn rs_generic_image_pull(
     image: Box<RsGenericImage>,
 ) -> Result<Box<RsContainerRequest>, String> {
-    let container_request = image
-        .image
-        .pull_image()
-        .map_err(|e| format!("Failed to pull container: {}", e))?;
-    Ok(Box::new(RsContainerRequest::new(container_request)))
+    Ok(Box::new(runtime().block_on(RsContainerRequest::from(*image).pull())?))
 }
 
 pub fn rs_generic_image_with_cmd(
     image: Box<RsGenericImage>,
     cmd: Vec<String>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(image.image.with_cmd(cmd)))
+    image.into_request(|image| image.with_cmd(cmd))
 }
 
 pub fn rs_generic_image_with_name(
     image: Box<RsGenericImage>,
     name: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(image.image.with_name(name)))
+    image.into_request(|image| image.with_name(name))
 }
 
 pub fn rs_generic_image_with_tag(
     image: Box<RsGenericImage>,
     tag: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(image.image.with_tag(tag)))
+    image.into_request(|image| image.with_tag(tag))
 }
 
 pub fn rs_generic_image_with_container_name(
     image: Box<RsGenericImage>,
     name: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image.image.with_container_name(name),
-    ))
+    image.into_request(|image| image.with_container_name(name))
 }
 
 pub fn rs_generic_image_with_platform(
     image: Box<RsGenericImage>,
     platform: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(image.image.with_platform(platform)))
+    image.into_request(|image| image.with_platform(platform))
 }
 
 pub fn rs_generic_image_with_network(
     image: Box<RsGenericImage>,
     network: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(image.image.with_network(network)))
+    image.into_request(|image| image.with_network(network))
 }
 
 pub fn rs_generic_image_with_label(
@@ -111,7 +139,7 @@ pub fn rs_generic_image_with_label(
     key: String,
     value: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(image.image.with_label(key, value)))
+    image.into_request(|image| image.with_label(key, value))
 }
 
 pub fn rs_generic_image_with_labels(
@@ -120,9 +148,7 @@ pub fn rs_generic_image_with_labels(
     values: Vec<String>,
 ) -> Box<RsContainerRequest> {
     let rust_labels: Vec<(String, String)> = keys.into_iter().zip(values.into_iter()).collect();
-    Box::new(RsContainerRequest::new(
-        image.image.with_labels(rust_labels),
-    ))
+    image.into_request(|image| image.with_labels(rust_labels))
 }
 
 pub fn rs_generic_image_with_host(
@@ -130,14 +156,14 @@ pub fn rs_generic_image_with_host(
     key: String,
     value: Box<RsHost>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(image.image.with_host(key, *value)))
+    image.into_request(|image| image.with_host(key, *value))
 }
 
 pub fn rs_generic_image_with_mount(
     image: Box<RsGenericImage>,
     mount: Box<RsMount>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(image.image.with_mount(*mount)))
+    image.into_request(|image| image.with_mount(*mount))
 }
 
 pub fn rs_generic_image_with_env_var(
@@ -145,16 +171,14 @@ pub fn rs_generic_image_with_env_var(
     name: String,
     value: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image.image.with_env_var(name, value),
-    ))
+    image.into_request(|image| image.with_env_var(name, value))
 }
 
 pub fn rs_generic_image_with_hostname(
     image: Box<RsGenericImage>,
     hostname: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(image.image.with_hostname(hostname)))
+    image.into_request(|image| image.with_hostname(hostname))
 }
 
 pub fn rs_generic_image_with_mapped_port(
@@ -162,118 +186,109 @@ pub fn rs_generic_image_with_mapped_port(
     host_port: u16,
     container_port: Box<RsContainerPort>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image
-            .image
-            .with_mapped_port(host_port, (*container_port).into()),
-    ))
+    image.into_request(|image| image.with_mapped_port(host_port, (*container_port).into()))
 }
 
 pub fn rs_generic_image_with_privileged(
     image: Box<RsGenericImage>,
     privileged: bool,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image.image.with_privileged(privileged),
-    ))
+    image.into_request(|image| image.with_privileged(privileged))
 }
 
 pub fn rs_generic_image_with_cap_add(
     image: Box<RsGenericImage>,
     capability: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image.image.with_cap_add(capability),
-    ))
+    image.into_request(|image| image.with_cap_add(capability))
 }
 
 pub fn rs_generic_image_with_cap_drop(
     image: Box<RsGenericImage>,
     capability: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image.image.with_cap_drop(capability),
-    ))
+    image.into_request(|image| image.with_cap_drop(capability))
 }
 
 pub fn rs_generic_image_with_cgroupns_mode(
     image: Box<RsGenericImage>,
     mode: Box<RsCgroupnsMode>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image.image.with_cgroupns_mode((*mode).into()),
-    ))
+    image.into_request(|image| image.with_cgroupns_mode((*mode).into()))
 }
 
 pub fn rs_generic_image_with_userns_mode(
     image: Box<RsGenericImage>,
     userns_mode: &str,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image.image.with_userns_mode(&userns_mode),
-    ))
+    image.into_request(|image| image.with_userns_mode(&userns_mode))
 }
 
 pub fn rs_generic_image_with_shm_size(
     image: Box<RsGenericImage>,
     bytes: u64,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(image.image.with_shm_size(bytes)))
+    image.into_request(|image| image.with_shm_size(bytes))
 }
 
 pub fn rs_generic_image_with_startup_timeout(
     image: Box<RsGenericImage>,
     timeout_ns: u64,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image
-            .image
-            .with_startup_timeout(Duration::from_nanos(timeout_ns)),
-    ))
+    image.into_request(|image| image.with_startup_timeout(Duration::from_nanos(timeout_ns)))
 }
 
 pub fn rs_generic_image_with_working_dir(
     image: Box<RsGenericImage>,
     working_dir: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image.image.with_working_dir(working_dir),
-    ))
+    image.into_request(|image| image.with_working_dir(working_dir))
+}
+
+pub fn rs_generic_image_with_log_consumer(
+    image: Box<RsGenericImage>,
+    callback: UniquePtr<LogConsumerCallback>,
+) -> Box<RsContainerRequest> {
+    image.into_request(|image| image.with_log_consumer(RsLogConsumer::new(callback)))
+}
+
+pub fn rs_generic_image_with_reuse(
+    image: Box<RsGenericImage>,
+    reuse: Box<RsReuseDirective>,
+) -> Box<RsContainerRequest> {
+    image.into_request(|image| image.with_reuse((*reuse).into()))
 }
 
 pub fn rs_generic_image_with_user(
     image: Box<RsGenericImage>,
     user: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(image.image.with_user(user)))
+    image.into_request(|image| image.with_user(user))
 }
 
 pub fn rs_generic_image_with_readonly_rootfs(
     image: Box<RsGenericImage>,
     readonly_rootfs: bool,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image.image.with_readonly_rootfs(readonly_rootfs),
-    ))
+    image.into_request(|image| image.with_readonly_rootfs(readonly_rootfs))
 }
 
 pub fn rs_generic_image_with_security_opt(
     image: Box<RsGenericImage>,
     security_opt: String,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image.image.with_security_opt(security_opt),
-    ))
+    image.into_request(|image| image.with_security_opt(security_opt))
 }
 
 pub fn rs_generic_image_with_ready_conditions(
     image: Box<RsGenericImage>,
     ready_conditions: Vec<RsWaitFor>,
 ) -> Box<RsContainerRequest> {
-    let conditions: Vec<_> = ready_conditions.into_iter().map(|wf| wf.strategy).collect();
-    Box::new(RsContainerRequest::new(
-        image.image.with_ready_conditions(conditions),
-    ))
+    let conditions = upstream_conditions(&ready_conditions);
+    let mut container_request =
+        image.into_request(|image| image.with_ready_conditions(conditions));
+    container_request.ready_conditions = ready_conditions;
+    container_request
 }
 
 pub fn rs_generic_image_with_copy_to(
@@ -281,9 +296,10 @@ pub fn rs_generic_image_with_copy_to(
     target: String,
     source: Box<RsCopyDataSource>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image.image.with_copy_to(target, *source),
-    ))
+    let copy_source = (target.clone(), source.digest());
+    let mut container_request = image.into_request(|image| image.with_copy_to(target, *source));
+    container_request.copy_sources.push(copy_source);
+    container_request
 }
 
 pub fn rs_generic_image_with_ulimit(
@@ -294,23 +310,54 @@ pub fn rs_generic_image_with_ulimit(
 ) -> Box<RsContainerRequest> {
     let hard_opt = hard_opt.first().copied();
     // WARNING: This will fail if hard_opt is nullopt because of bug in testcontainers-rs???
-    Box::new(RsContainerRequest::new(
-        image.image.with_ulimit(name, soft, hard_opt),
-    ))
+    image.into_request(|image| image.with_ulimit(name, soft, hard_opt))
 }
 
 pub fn rs_generic_image_with_health_check(
     image: Box<RsGenericImage>,
     health_check: Box<RsHealthcheck>,
 ) -> Box<RsContainerRequest> {
-    Box::new(RsContainerRequest::new(
-        image.image.with_health_check(health_check.healthcheck),
-    ))
+    image.into_request(|image| image.with_health_check(health_check.healthcheck))
 }
 
 impl RsGenericImage {
     pub fn new(image: GenericImage) -> Self {
-        Self { image }
+        let ready_conditions = image
+            .ready_conditions()
+            .into_iter()
+            .map(RsWaitFor::new)
+            .collect();
+        Self {
+            image,
+            ready_conditions,
+        }
+    }
+
+    /// Applies a testcontainers builder call, keeping the ready conditions with their native form.
+    pub fn map(self: Box<Self>, f: impl FnOnce(GenericImage) -> GenericImage) -> Box<Self> {
+        let Self {
+            image,
+            ready_conditions,
+        } = *self;
+        Box::new(Self {
+            image: f(image),
+            ready_conditions,
+        })
+    }
+
+    pub fn into_request(
+        self: Box<Self>,
+        f: impl FnOnce(GenericImage) -> ContainerRequest<GenericImage>,
+    ) -> Box<RsContainerRequest> {
+        let Self {
+            image,
+            ready_conditions,
+        } = *self;
+        Box::new(RsContainerRequest {
+            container: f(image),
+            ready_conditions,
+            copy_sources: Vec::new(),
+        })
     }
 
     pub fn rs_generic_image_name(&self) -> &str {
@@ -338,10 +385,16 @@ impl RsGenericImage {
     }
 
     pub fn rs_generic_image_ready_conditions(&self) -> Vec<RsWaitFor> {
-        self.image
-            .ready_conditions()
-            .into_iter()
-            .map(|wf| RsWaitFor { strategy: wf })
-            .collect()
+        self.ready_conditions.clone()
+    }
+}
+
+impl From<RsGenericImage> for RsContainerRequest {
+    fn from(image: RsGenericImage) -> Self {
+        Self {
+            container: image.image.into(),
+            ready_conditions: image.ready_conditions,
+            copy_sources: Vec::new(),
+        }
     }
 }
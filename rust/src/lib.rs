@@ -1,35 +1,54 @@
+pub mod async_task;
 pub mod buildable_image;
 pub mod container;
 pub mod container_request;
+pub mod container_spec;
 pub mod core;
+pub mod docker;
 pub mod image;
+pub mod reaper;
+pub mod runtime;
 pub mod system;
 
+use crate::async_task::{
+    rs_async_task_destroy, rs_async_task_into_container, rs_async_task_into_container_request,
+    rs_async_task_into_exec_result, rs_async_task_into_unit, RsAsyncTask,
+};
 use crate::buildable_image::{
     rs_generic_buildable_image_build, rs_generic_buildable_image_destroy,
     rs_generic_buildable_image_new, rs_generic_buildable_image_with_data,
     rs_generic_buildable_image_with_dockerfile, rs_generic_buildable_image_with_dockerfile_string,
     rs_generic_buildable_image_with_file, RsGenericBuildableImage,
 };
-use crate::container::{rs_container_destroy, rs_container_rm, RsContainer};
+use crate::container::{
+    rs_container_destroy, rs_container_rm, rs_container_teardown_all, rs_container_vec_push,
+    RsContainer,
+};
 use crate::container_request::{
-    rs_container_request_destroy, rs_container_request_pull, rs_container_request_start,
+    rs_container_request_clone, rs_container_request_destroy, rs_container_request_pull,
+    rs_container_request_pull_async, rs_container_request_spec_key, rs_container_request_start,
+    rs_container_request_start_all, rs_container_request_start_async,
+    rs_container_request_vec_push,
     rs_container_request_with_cap_add, rs_container_request_with_cap_drop,
     rs_container_request_with_cgroupns_mode, rs_container_request_with_cmd,
     rs_container_request_with_container_name, rs_container_request_with_copy_to,
     rs_container_request_with_env_var, rs_container_request_with_health_check,
     rs_container_request_with_host, rs_container_request_with_hostname,
     rs_container_request_with_label, rs_container_request_with_labels,
+    rs_container_request_with_log_consumer,
     rs_container_request_with_mapped_port, rs_container_request_with_mount,
     rs_container_request_with_name, rs_container_request_with_network,
     rs_container_request_with_platform, rs_container_request_with_privileged,
     rs_container_request_with_readonly_rootfs, rs_container_request_with_ready_conditions,
+    rs_container_request_with_reuse,
     rs_container_request_with_security_opt, rs_container_request_with_shm_size,
     rs_container_request_with_startup_timeout, rs_container_request_with_tag,
     rs_container_request_with_ulimit, rs_container_request_with_user,
     rs_container_request_with_userns_mode, rs_container_request_with_working_dir,
-    RsContainerRequest,
+    rs_container_start_result_destroy, rs_container_start_result_into_container,
+    rs_container_start_result_vec_pop, RsContainerRequest, RsContainerStartResult,
 };
+use crate::container_spec::rs_container_request_from_spec;
 use crate::core::cgroupns_mode::{
     rs_cgroupns_mode_destroy, rs_cgroupns_mode_host, rs_cgroupns_mode_private, RsCgroupnsMode,
 };
@@ -39,7 +58,7 @@ use crate::core::container_port::{
 };
 use crate::core::copy_data_source::{
     rs_copy_data_source_data, rs_copy_data_source_destroy, rs_copy_data_source_file,
-    RsCopyDataSource,
+    rs_copy_data_source_is_mapped_file, rs_copy_data_source_mapped_file, RsCopyDataSource,
 };
 use crate::core::exec::exec_command::{
     rs_exec_command_destroy, rs_exec_command_new, rs_exec_command_with_container_ready_conditions,
@@ -47,7 +66,11 @@ use crate::core::exec::exec_command::{
 };
 use crate::core::exec::sync_exec_result::{
     rs_sync_exec_result_destroy, rs_sync_exec_result_exit_code_opt,
-    rs_sync_exec_result_stderr_to_vec, rs_sync_exec_result_stdout_to_vec, RsSyncExecResult,
+    rs_sync_exec_result_stderr_bytes, rs_sync_exec_result_stderr_to_vec,
+    rs_sync_exec_result_stdout_bytes, rs_sync_exec_result_stdout_to_vec, RsSyncExecResult,
+};
+use crate::core::file_reader::{
+    rs_file_reader_destroy, rs_file_reader_read, rs_file_reader_size, RsFileReader,
 };
 use crate::core::healthcheck::{
     rs_healthcheck_cmd, rs_healthcheck_cmd_shell, rs_healthcheck_destroy, rs_healthcheck_empty,
@@ -56,45 +79,77 @@ use crate::core::healthcheck::{
     rs_healthcheck_with_timeout, RsHealthcheck,
 };
 use crate::core::host::{rs_host_addr, rs_host_destroy, rs_host_host_gateway_linux, RsHost};
+use crate::core::log_stream::{
+    rs_log_stream_destroy, rs_log_stream_read, rs_log_stream_read_line, RsLogStream,
+};
 use crate::core::mount::{
     rs_mount_bind_mount, rs_mount_destroy, rs_mount_tmpfs_mount, rs_mount_volume_mount,
     rs_mount_with_mode, rs_mount_with_read_only, rs_mount_with_read_write,
     rs_mount_with_size_bytes, RsMount,
 };
+use crate::core::reuse_directive::{
+    rs_reuse_directive_always, rs_reuse_directive_current_session, rs_reuse_directive_destroy,
+    rs_reuse_directive_never, RsReuseDirective,
+};
 use crate::core::wait::exit_wait_strategy::{
-    rs_exit_wait_strategy_destroy, rs_exit_wait_strategy_new, rs_exit_wait_strategy_with_exit_code,
-    rs_exit_wait_strategy_with_poll_interval, RsExitWaitStrategy,
+    rs_exit_wait_strategy_destroy, rs_exit_wait_strategy_new, rs_exit_wait_strategy_with_events,
+    rs_exit_wait_strategy_with_exit_code, rs_exit_wait_strategy_with_poll_backoff,
+    rs_exit_wait_strategy_with_poll_interval, rs_exit_wait_strategy_with_poll_jitter,
+    RsExitWaitStrategy,
 };
 use crate::core::wait::health_wait_strategy::{
     rs_health_wait_strategy_destroy, rs_health_wait_strategy_new,
-    rs_health_wait_strategy_with_poll_interval, RsHealthWaitStrategy,
+    rs_health_wait_strategy_with_events, rs_health_wait_strategy_with_poll_backoff,
+    rs_health_wait_strategy_with_poll_interval, rs_health_wait_strategy_with_poll_jitter,
+    RsHealthWaitStrategy,
+};
+use crate::core::wait::http_wait_strategy::{
+    rs_http_wait_strategy_destroy, rs_http_wait_strategy_new,
+    rs_http_wait_strategy_with_body_matcher, rs_http_wait_strategy_with_expected_status_code,
+    rs_http_wait_strategy_with_poll_interval, rs_http_wait_strategy_with_port,
+    rs_http_wait_strategy_with_tls, RsHttpWaitStrategy,
 };
 use crate::core::wait::log_wait_strategy::{
-    rs_log_wait_strategy_destroy, rs_log_wait_strategy_stderr, rs_log_wait_strategy_stdout,
-    rs_log_wait_strategy_stdout_or_stderr, rs_log_wait_strategy_with_times, RsLogWaitStrategy,
+    rs_log_wait_strategy_destroy, rs_log_wait_strategy_stderr, rs_log_wait_strategy_stderr_regex,
+    rs_log_wait_strategy_stdout, rs_log_wait_strategy_stdout_or_stderr,
+    rs_log_wait_strategy_stdout_or_stderr_regex, rs_log_wait_strategy_stdout_regex,
+    rs_log_wait_strategy_with_times, RsLogWaitStrategy,
 };
 use crate::core::wait::wait_for::{
-    rs_wait_for_destroy, rs_wait_for_duration, rs_wait_for_exit,
-    rs_wait_for_healthcheck, rs_wait_for_log, rs_wait_for_millis_in_env_var, rs_wait_for_nothing,
+    rs_wait_for_all_of, rs_wait_for_any_of, rs_wait_for_destroy, rs_wait_for_duration,
+    rs_wait_for_exit,
+    rs_wait_for_healthcheck, rs_wait_for_http, rs_wait_for_listening_port, rs_wait_for_log,
+    rs_wait_for_millis_in_env_var, rs_wait_for_nothing,
     rs_wait_for_vec_pop, rs_wait_for_vec_push, RsWaitFor,
 };
 use crate::image::{
-    rs_generic_image_destroy, rs_generic_image_new, rs_generic_image_pull, rs_generic_image_start,
+    rs_generic_image_clone, rs_generic_image_destroy, rs_generic_image_into_container_request,
+    rs_generic_image_new,
+    rs_generic_image_pull, rs_generic_image_pull_async, rs_generic_image_start,
+    rs_generic_image_start_async,
     rs_generic_image_with_cap_add, rs_generic_image_with_cap_drop,
     rs_generic_image_with_cgroupns_mode, rs_generic_image_with_cmd,
     rs_generic_image_with_container_name, rs_generic_image_with_copy_to,
     rs_generic_image_with_entrypoint, rs_generic_image_with_env_var,
     rs_generic_image_with_exposed_port, rs_generic_image_with_health_check,
     rs_generic_image_with_host, rs_generic_image_with_hostname, rs_generic_image_with_label,
-    rs_generic_image_with_labels, rs_generic_image_with_mapped_port, rs_generic_image_with_mount,
+    rs_generic_image_with_labels, rs_generic_image_with_log_consumer,
+    rs_generic_image_with_mapped_port, rs_generic_image_with_mount,
     rs_generic_image_with_name, rs_generic_image_with_network, rs_generic_image_with_platform,
     rs_generic_image_with_privileged, rs_generic_image_with_readonly_rootfs,
-    rs_generic_image_with_ready_conditions, rs_generic_image_with_security_opt,
+    rs_generic_image_with_ready_conditions, rs_generic_image_with_reuse,
+    rs_generic_image_with_security_opt,
     rs_generic_image_with_shm_size, rs_generic_image_with_startup_timeout,
     rs_generic_image_with_tag, rs_generic_image_with_ulimit, rs_generic_image_with_user,
     rs_generic_image_with_userns_mode, rs_generic_image_with_wait_for,
     rs_generic_image_with_working_dir, RsGenericImage,
 };
+use crate::reaper::{
+    rs_reaper_drain, rs_reaper_flush, rs_reaper_is_enabled, rs_reaper_pending,
+    rs_reaper_set_enabled,
+};
+use crate::runtime::rs_runtime_configure;
+use crate::system::bytes::{rs_bytes_destroy, RsBytes};
 use crate::system::ip::ip_addr::{
     rs_ip_addr_destroy, rs_ip_addr_from_ipv4, rs_ip_addr_from_ipv6, RsIpAddr,
 };
@@ -128,16 +183,109 @@ mod ffi {
         Sctp = 9,
     }
 
+    enum RsMountType {
+        Bind,
+        Volume,
+        Tmpfs,
+    }
+
+    struct RsPortSpec {
+        port: u16,
+        port_type: RsContainerPortType,
+    }
+
+    struct RsPortMappingSpec {
+        host_port: u16,
+        container_port: RsPortSpec,
+    }
+
+    struct RsMountSpec {
+        mount_type: RsMountType,
+        source: String,
+        target: String,
+        read_only: bool,
+    }
+
+    struct RsContainerSpec {
+        name: String,
+        tag: String,
+        entrypoint_opt: Vec<String>,
+        cmd: Vec<String>,
+        exposed_ports: Vec<RsPortSpec>,
+        mapped_ports: Vec<RsPortMappingSpec>,
+        env_keys: Vec<String>,
+        env_values: Vec<String>,
+        label_keys: Vec<String>,
+        label_values: Vec<String>,
+        mounts: Vec<RsMountSpec>,
+        container_name_opt: Vec<String>,
+        hostname_opt: Vec<String>,
+        network_opt: Vec<String>,
+        platform_opt: Vec<String>,
+        working_dir_opt: Vec<String>,
+        user_opt: Vec<String>,
+        userns_mode_opt: Vec<String>,
+        privileged: bool,
+        readonly_rootfs: bool,
+        shm_size_opt: Vec<u64>,
+        startup_timeout_ns_opt: Vec<u64>,
+        cap_add: Vec<String>,
+        cap_drop: Vec<String>,
+        security_opts: Vec<String>,
+    }
+
+    struct RsConditionTiming {
+        description: String,
+        duration_ns: u64,
+    }
+
+    struct RsStartupProfile {
+        pull_ns: u64,
+        create_ns: u64,
+        start_ns: u64,
+        conditions: Vec<RsConditionTiming>,
+        total_ns: u64,
+    }
+
+    #[namespace = "testcontainers::details"]
+    unsafe extern "C++" {
+        include!("details/AsyncWaker.hpp");
+
+        type AsyncWaker;
+        fn wake(self: &AsyncWaker);
+
+        include!("details/LogConsumerCallback.hpp");
+
+        type LogConsumerCallback;
+        fn consume(self: &LogConsumerCallback, data: &[u8], ends: &[usize], sources: &[u8]) -> Result<()>;
+
+        include!("details/HttpBodyMatcher.hpp");
+
+        type HttpBodyMatcher;
+        fn matches(self: &HttpBodyMatcher, body: &[u8]) -> Result<bool>;
+    }
+
     extern "Rust" {
         fn version() -> String;
 
+        fn rs_runtime_configure(worker_threads: usize) -> Result<()>;
+
+        fn rs_reaper_set_enabled(enabled: bool);
+        fn rs_reaper_is_enabled() -> bool;
+        fn rs_reaper_pending() -> usize;
+        fn rs_reaper_flush();
+        fn rs_reaper_drain();
+
         type RsGenericImage;
         type RsGenericBuildableImage;
         type RsContainer;
         type RsContainerRequest;
+        type RsContainerStartResult;
+        type RsAsyncTask;
         type RsWaitFor;
         type RsLogWaitStrategy;
         type RsHealthWaitStrategy;
+        type RsHttpWaitStrategy;
         type RsExitWaitStrategy;
         type RsContainerPort;
         type RsHost;
@@ -145,16 +293,21 @@ mod ffi {
         type RsCopyDataSource;
         type RsHealthcheck;
         type RsCgroupnsMode;
+        type RsReuseDirective;
         type RsExecCommand;
         type RsSyncExecResult;
+        type RsLogStream;
+        type RsFileReader;
         type RsIpAddr;
         type RsIpv4Addr;
         type RsIpv6Addr;
         type RsUrlHost;
         type RsPath;
+        type RsBytes;
 
         fn rs_generic_image_new(name: String, tag: String) -> Box<RsGenericImage>;
         fn rs_generic_image_destroy(image: Box<RsGenericImage>);
+        fn rs_generic_image_clone(image: &RsGenericImage) -> Box<RsGenericImage>;
         fn rs_generic_image_name(self: &RsGenericImage) -> &str;
         fn rs_generic_image_tag(self: &RsGenericImage) -> &str;
         fn rs_generic_image_entrypoint_opt(self: &RsGenericImage) -> Vec<String>;
@@ -165,7 +318,7 @@ mod ffi {
         fn rs_generic_buildable_image_with_dockerfile(image: Box<RsGenericBuildableImage>, source: Box<RsPath>) -> Box<RsGenericBuildableImage>;
         fn rs_generic_buildable_image_with_dockerfile_string(image: Box<RsGenericBuildableImage>, content: String) -> Box<RsGenericBuildableImage>;
         fn rs_generic_buildable_image_with_file(image: Box<RsGenericBuildableImage>, source: Box<RsPath>, target: String) -> Box<RsGenericBuildableImage>;
-        fn rs_generic_buildable_image_with_data(image: Box<RsGenericBuildableImage>, data: Vec<u8>, target: String) -> Box<RsGenericBuildableImage>;
+        fn rs_generic_buildable_image_with_data(image: Box<RsGenericBuildableImage>, data: &[u8], target: String) -> Box<RsGenericBuildableImage>;
         fn rs_generic_buildable_image_build(image: Box<RsGenericBuildableImage>) -> Result<Box<RsGenericImage>>;
         fn rs_generic_buildable_image_destroy(image: Box<RsGenericBuildableImage>);
         fn rs_generic_image_with_exposed_port(image: Box<RsGenericImage>, port: Box<RsContainerPort>) -> Box<RsGenericImage>;
@@ -173,6 +326,9 @@ mod ffi {
         fn rs_generic_image_with_wait_for(image: Box<RsGenericImage>, wait_for: Box<RsWaitFor>) -> Box<RsGenericImage>;
         fn rs_generic_image_start(image: Box<RsGenericImage>) -> Result<Box<RsContainer>>;
         fn rs_generic_image_pull(image: Box<RsGenericImage>) -> Result<Box<RsContainerRequest>>;
+        fn rs_generic_image_start_async(image: Box<RsGenericImage>) -> Box<RsAsyncTask>;
+        fn rs_generic_image_pull_async(image: Box<RsGenericImage>) -> Box<RsAsyncTask>;
+        fn rs_generic_image_into_container_request(image: Box<RsGenericImage>) -> Box<RsContainerRequest>;
         fn rs_generic_image_with_cmd(image: Box<RsGenericImage>, cmd: Vec<String>) -> Box<RsContainerRequest>;
         fn rs_generic_image_with_name(image: Box<RsGenericImage>, name: String) -> Box<RsContainerRequest>;
         fn rs_generic_image_with_tag(image: Box<RsGenericImage>, tag: String) -> Box<RsContainerRequest>;
@@ -194,6 +350,8 @@ mod ffi {
         fn rs_generic_image_with_shm_size(image: Box<RsGenericImage>, bytes: u64) -> Box<RsContainerRequest>;
         fn rs_generic_image_with_startup_timeout(image: Box<RsGenericImage>, timeout_ns: u64) -> Box<RsContainerRequest>;
         fn rs_generic_image_with_working_dir(image: Box<RsGenericImage>, working_dir: String) -> Box<RsContainerRequest>;
+        fn rs_generic_image_with_log_consumer(image: Box<RsGenericImage>, callback: UniquePtr<LogConsumerCallback>) -> Box<RsContainerRequest>;
+        fn rs_generic_image_with_reuse(image: Box<RsGenericImage>, reuse: Box<RsReuseDirective>) -> Box<RsContainerRequest>;
         fn rs_generic_image_with_user(image: Box<RsGenericImage>, user: String) -> Box<RsContainerRequest>;
         fn rs_generic_image_with_readonly_rootfs(image: Box<RsGenericImage>, readonly_rootfs: bool) -> Box<RsContainerRequest>;
         fn rs_generic_image_with_security_opt(image: Box<RsGenericImage>, security_opt: String) -> Box<RsContainerRequest>;
@@ -226,7 +384,9 @@ mod ffi {
         fn rs_mount_destroy(mount: Box<RsMount>);
 
         fn rs_copy_data_source_file(path: Box<RsPath>) -> Box<RsCopyDataSource>;
-        fn rs_copy_data_source_data(data: Vec<u8>) -> Box<RsCopyDataSource>;
+        fn rs_copy_data_source_data(data: &[u8]) -> Box<RsCopyDataSource>;
+        fn rs_copy_data_source_mapped_file(path: Box<RsPath>) -> Box<RsCopyDataSource>;
+        fn rs_copy_data_source_is_mapped_file(source: &RsCopyDataSource) -> bool;
         fn rs_copy_data_source_destroy(source: Box<RsCopyDataSource>);
 
         fn rs_healthcheck_none() -> Box<RsHealthcheck>;
@@ -248,14 +408,26 @@ mod ffi {
         fn rs_container_get_bridge_ip_address(self: &RsContainer) -> Result<Box<RsIpAddr>>;
         fn rs_container_get_host(self: &RsContainer) -> Result<Box<RsUrlHost>>;
         fn rs_container_exec(self: &RsContainer, cmd: Box<RsExecCommand>) -> Result<Box<RsSyncExecResult>>;
+        fn rs_container_exec_async(self: &RsContainer, cmd: Box<RsExecCommand>) -> Box<RsAsyncTask>;
+        fn rs_container_copy_to(self: &RsContainer, target: &str, source: Box<RsCopyDataSource>) -> Result<()>;
+        fn rs_container_copy_file_from(self: &RsContainer, path: &str) -> Result<Box<RsFileReader>>;
+        fn rs_container_copy_to_host(self: &RsContainer, path: &str, host_path: Box<RsPath>) -> Result<()>;
         fn rs_container_stop(self: &RsContainer) -> Result<()>;
+        fn rs_container_stop_async(self: &RsContainer) -> Box<RsAsyncTask>;
         fn rs_container_stop_with_timeout(self: &RsContainer, timeout_sec_opt: Vec<i32>) -> Result<()>;
         fn rs_container_start(self: &RsContainer) -> Result<()>;
         fn rs_container_rm(container: Box<RsContainer>) -> Result<()>;
+        fn rs_container_vec_push(vec: &mut Vec<RsContainer>, container: Box<RsContainer>);
+        fn rs_container_teardown_all(containers: Vec<RsContainer>, stop_timeout_sec_opt: Vec<i32>) -> Result<()>;
         fn rs_container_stdout_to_vec(self: &RsContainer) -> Result<Vec<u8>>;
         fn rs_container_stderr_to_vec(self: &RsContainer) -> Result<Vec<u8>>;
+        fn rs_container_stdout_bytes(self: &RsContainer) -> Result<Box<RsBytes>>;
+        fn rs_container_stderr_bytes(self: &RsContainer) -> Result<Box<RsBytes>>;
+        fn rs_container_stdout(self: &RsContainer, follow: bool) -> Box<RsLogStream>;
+        fn rs_container_stderr(self: &RsContainer, follow: bool) -> Box<RsLogStream>;
         fn rs_container_is_running(self: &RsContainer) -> Result<bool>;
         fn rs_container_exit_code_opt(self: &RsContainer) -> Result<Vec<i64>>;
+        fn rs_container_startup_profile(self: &RsContainer) -> Result<RsStartupProfile>;
 
         fn rs_container_request_destroy(container_request: Box<RsContainerRequest>);
         fn rs_container_request_with_cmd(container_request: Box<RsContainerRequest>, cmd: Vec<String>) -> Box<RsContainerRequest>;
@@ -279,6 +451,8 @@ mod ffi {
         fn rs_container_request_with_shm_size(container_request: Box<RsContainerRequest>, bytes: u64) -> Box<RsContainerRequest>;
         fn rs_container_request_with_startup_timeout(container_request: Box<RsContainerRequest>, timeout_ns: u64) -> Box<RsContainerRequest>;
         fn rs_container_request_with_working_dir(container_request: Box<RsContainerRequest>, working_dir: String) -> Box<RsContainerRequest>;
+        fn rs_container_request_with_log_consumer(container_request: Box<RsContainerRequest>, callback: UniquePtr<LogConsumerCallback>) -> Box<RsContainerRequest>;
+        fn rs_container_request_with_reuse(container_request: Box<RsContainerRequest>, reuse: Box<RsReuseDirective>) -> Box<RsContainerRequest>;
         fn rs_container_request_with_user(container_request: Box<RsContainerRequest>, user: String) -> Box<RsContainerRequest>;
         fn rs_container_request_with_readonly_rootfs(container_request: Box<RsContainerRequest>, readonly_rootfs: bool) -> Box<RsContainerRequest>;
         fn rs_container_request_with_security_opt(container_request: Box<RsContainerRequest>, security_opt: String) -> Box<RsContainerRequest>;
@@ -288,13 +462,38 @@ mod ffi {
         fn rs_container_request_with_health_check(container_request: Box<RsContainerRequest>, health_check: Box<RsHealthcheck>) -> Box<RsContainerRequest>;
         fn rs_container_request_start(container_request: Box<RsContainerRequest>) -> Result<Box<RsContainer>>;
         fn rs_container_request_pull(container_request: Box<RsContainerRequest>) -> Result<Box<RsContainerRequest>>;
+        fn rs_container_request_start_async(container_request: Box<RsContainerRequest>) -> Box<RsAsyncTask>;
+        fn rs_container_request_pull_async(container_request: Box<RsContainerRequest>) -> Box<RsAsyncTask>;
+        fn rs_container_request_clone(container_request: &RsContainerRequest) -> Box<RsContainerRequest>;
+        fn rs_container_request_spec_key(container_request: &RsContainerRequest) -> String;
+        fn rs_container_request_from_spec(spec: RsContainerSpec) -> Box<RsContainerRequest>;
+        fn rs_container_request_start_all(container_requests: Vec<RsContainerRequest>) -> Vec<RsContainerStartResult>;
+        fn rs_container_request_vec_push(vec: &mut Vec<RsContainerRequest>, container_request: Box<RsContainerRequest>);
+
+        fn rs_container_start_result_vec_pop(vec: &mut Vec<RsContainerStartResult>) -> Result<Box<RsContainerStartResult>>;
+        fn rs_container_start_result_into_container(result: Box<RsContainerStartResult>) -> Result<Box<RsContainer>>;
+        fn rs_container_start_result_destroy(result: Box<RsContainerStartResult>);
+
+        fn rs_async_task_is_ready(self: &RsAsyncTask) -> bool;
+        fn rs_async_task_wait(self: &RsAsyncTask);
+        fn rs_async_task_wait_for(self: &RsAsyncTask, timeout_ns: u64) -> bool;
+        fn rs_async_task_on_ready(self: &RsAsyncTask, waker: UniquePtr<AsyncWaker>);
+        fn rs_async_task_into_unit(task: Box<RsAsyncTask>) -> Result<()>;
+        fn rs_async_task_into_container(task: Box<RsAsyncTask>) -> Result<Box<RsContainer>>;
+        fn rs_async_task_into_container_request(task: Box<RsAsyncTask>) -> Result<Box<RsContainerRequest>>;
+        fn rs_async_task_into_exec_result(task: Box<RsAsyncTask>) -> Result<Box<RsSyncExecResult>>;
+        fn rs_async_task_destroy(task: Box<RsAsyncTask>);
 
         fn rs_wait_for_nothing() -> Box<RsWaitFor>;
         fn rs_wait_for_duration(duration_ns: u64) -> Box<RsWaitFor>;
         fn rs_wait_for_log(strategy: Box<RsLogWaitStrategy>) -> Box<RsWaitFor>;
         fn rs_wait_for_healthcheck(strategy: Box<RsHealthWaitStrategy>) -> Box<RsWaitFor>;
         fn rs_wait_for_exit(strategy: Box<RsExitWaitStrategy>) -> Box<RsWaitFor>;
+        fn rs_wait_for_http(strategy: Box<RsHttpWaitStrategy>) -> Box<RsWaitFor>;
         fn rs_wait_for_millis_in_env_var(name: &'static str) -> Box<RsWaitFor>;
+        fn rs_wait_for_listening_port(port: Box<RsContainerPort>, timeout_ns: u64) -> Box<RsWaitFor>;
+        fn rs_wait_for_all_of(conditions: Vec<RsWaitFor>) -> Result<Box<RsWaitFor>>;
+        fn rs_wait_for_any_of(conditions: Vec<RsWaitFor>) -> Result<Box<RsWaitFor>>;
         fn rs_wait_for_vec_push(vec: &mut Vec<RsWaitFor>, wait_for: Box<RsWaitFor>);
         fn rs_wait_for_vec_pop(vec: &mut Vec<RsWaitFor>) -> Result<Box<RsWaitFor>>;
         fn rs_wait_for_clone(self: &RsWaitFor) -> Box<RsWaitFor>;
@@ -304,21 +503,43 @@ mod ffi {
         fn rs_log_wait_strategy_stdout(message: String) -> Box<RsLogWaitStrategy>;
         fn rs_log_wait_strategy_stderr(message: String) -> Box<RsLogWaitStrategy>;
         fn rs_log_wait_strategy_stdout_or_stderr(message: String) -> Box<RsLogWaitStrategy>;
+        fn rs_log_wait_strategy_stdout_regex(patterns: Vec<String>) -> Result<Box<RsLogWaitStrategy>>;
+        fn rs_log_wait_strategy_stderr_regex(patterns: Vec<String>) -> Result<Box<RsLogWaitStrategy>>;
+        fn rs_log_wait_strategy_stdout_or_stderr_regex(patterns: Vec<String>) -> Result<Box<RsLogWaitStrategy>>;
         fn rs_log_wait_strategy_with_times(strategy: Box<RsLogWaitStrategy>, times: usize) -> Box<RsLogWaitStrategy>;
 
         fn rs_health_wait_strategy_destroy(strategy: Box<RsHealthWaitStrategy>);
         fn rs_health_wait_strategy_new() -> Box<RsHealthWaitStrategy>;
         fn rs_health_wait_strategy_with_poll_interval(strategy: Box<RsHealthWaitStrategy>, interval_ns: u64) -> Box<RsHealthWaitStrategy>;
+        fn rs_health_wait_strategy_with_poll_backoff(strategy: Box<RsHealthWaitStrategy>, initial_ns: u64, multiplier: f64, max_ns: u64) -> Box<RsHealthWaitStrategy>;
+        fn rs_health_wait_strategy_with_poll_jitter(strategy: Box<RsHealthWaitStrategy>, fraction: f64) -> Box<RsHealthWaitStrategy>;
+        fn rs_health_wait_strategy_with_events(strategy: Box<RsHealthWaitStrategy>) -> Box<RsHealthWaitStrategy>;
+
+        fn rs_http_wait_strategy_destroy(strategy: Box<RsHttpWaitStrategy>);
+        fn rs_http_wait_strategy_new(path: String) -> Box<RsHttpWaitStrategy>;
+        fn rs_http_wait_strategy_with_port(strategy: Box<RsHttpWaitStrategy>, port: Box<RsContainerPort>) -> Box<RsHttpWaitStrategy>;
+        fn rs_http_wait_strategy_with_expected_status_code(strategy: Box<RsHttpWaitStrategy>, status: u16) -> Box<RsHttpWaitStrategy>;
+        fn rs_http_wait_strategy_with_body_matcher(strategy: Box<RsHttpWaitStrategy>, matcher: UniquePtr<HttpBodyMatcher>) -> Box<RsHttpWaitStrategy>;
+        fn rs_http_wait_strategy_with_poll_interval(strategy: Box<RsHttpWaitStrategy>, interval_ns: u64) -> Box<RsHttpWaitStrategy>;
+        fn rs_http_wait_strategy_with_tls(strategy: Box<RsHttpWaitStrategy>) -> Box<RsHttpWaitStrategy>;
 
         fn rs_exit_wait_strategy_destroy(strategy: Box<RsExitWaitStrategy>);
         fn rs_exit_wait_strategy_new() -> Box<RsExitWaitStrategy>;
         fn rs_exit_wait_strategy_with_poll_interval(strategy: Box<RsExitWaitStrategy>, interval_ns: u64) -> Box<RsExitWaitStrategy>;
+        fn rs_exit_wait_strategy_with_poll_backoff(strategy: Box<RsExitWaitStrategy>, initial_ns: u64, multiplier: f64, max_ns: u64) -> Box<RsExitWaitStrategy>;
+        fn rs_exit_wait_strategy_with_poll_jitter(strategy: Box<RsExitWaitStrategy>, fraction: f64) -> Box<RsExitWaitStrategy>;
         fn rs_exit_wait_strategy_with_exit_code(strategy: Box<RsExitWaitStrategy>, exit_code: i64) -> Box<RsExitWaitStrategy>;
+        fn rs_exit_wait_strategy_with_events(strategy: Box<RsExitWaitStrategy>) -> Box<RsExitWaitStrategy>;
 
         fn rs_cgroupns_mode_private() -> Box<RsCgroupnsMode>;
         fn rs_cgroupns_mode_host() -> Box<RsCgroupnsMode>;
         fn rs_cgroupns_mode_destroy(mode: Box<RsCgroupnsMode>);
 
+        fn rs_reuse_directive_never() -> Box<RsReuseDirective>;
+        fn rs_reuse_directive_always() -> Box<RsReuseDirective>;
+        fn rs_reuse_directive_current_session() -> Box<RsReuseDirective>;
+        fn rs_reuse_directive_destroy(directive: Box<RsReuseDirective>);
+
         fn rs_exec_command_new(cmd: Vec<String>) -> Box<RsExecCommand>;
         fn rs_exec_command_with_container_ready_conditions(command: Box<RsExecCommand>, ready_conditions: Vec<RsWaitFor>) -> Box<RsExecCommand>;
         fn rs_exec_command_destroy(command: Box<RsExecCommand>);
@@ -326,8 +547,18 @@ mod ffi {
         fn rs_sync_exec_result_exit_code_opt(result: &mut RsSyncExecResult) -> Result<Vec<i64>>;
         fn rs_sync_exec_result_stdout_to_vec(result: &mut RsSyncExecResult) -> Result<Vec<u8>>;
         fn rs_sync_exec_result_stderr_to_vec(result: &mut RsSyncExecResult) -> Result<Vec<u8>>;
+        fn rs_sync_exec_result_stdout_bytes(result: &mut RsSyncExecResult) -> Result<Box<RsBytes>>;
+        fn rs_sync_exec_result_stderr_bytes(result: &mut RsSyncExecResult) -> Result<Box<RsBytes>>;
         fn rs_sync_exec_result_destroy(result: Box<RsSyncExecResult>);
 
+        fn rs_log_stream_read(stream: &mut RsLogStream, buf: &mut [u8]) -> Result<usize>;
+        fn rs_log_stream_read_line(stream: &mut RsLogStream, line: &mut Vec<u8>) -> Result<bool>;
+        fn rs_log_stream_destroy(stream: Box<RsLogStream>);
+
+        fn rs_file_reader_read(reader: &mut RsFileReader, buf: &mut [u8]) -> Result<usize>;
+        fn rs_file_reader_size(reader: &RsFileReader) -> u64;
+        fn rs_file_reader_destroy(reader: Box<RsFileReader>);
+
         fn rs_ipv4_addr_new(a: u8, b: u8, c: u8, d: u8) -> Box<RsIpv4Addr>;
         fn rs_ipv4_addr_localhost() -> Box<RsIpv4Addr>;
         fn rs_ipv4_addr_unspecified() -> Box<RsIpv4Addr>;
@@ -407,5 +638,8 @@ mod ffi {
         fn rs_path_from_utf16(w: &[u16]) -> Box<RsPath>;
         fn rs_path_to_string_opt(self: &RsPath) -> Result<Vec<String>>;
         fn rs_path_destroy(path: Box<RsPath>);
+
+        fn rs_bytes_as_slice(self: &RsBytes) -> &[u8];
+        fn rs_bytes_destroy(bytes: Box<RsBytes>);
     }
 }
@@ -0,0 +1,64 @@
+use crate::runtime::runtime;
+use std::sync::atomic::{AtomicBool, AtomicUsize, Ordering};
+use std::sync::Mutex;
+use tokio::task::JoinSet;
+
+static ENABLED: AtomicBool = AtomicBool::new(false);
+static PENDING: AtomicUsize = AtomicUsize::new(0);
+static TASKS: Mutex<Option<JoinSet<()>>> = Mutex::new(None);
+// Serializes flushes, so a second caller waits until the first one has drained everything
+static FLUSH: Mutex<()> = Mutex::new(());
+
+/// Turn deferred removal of dropped containers on or off.
+pub fn rs_reaper_set_enabled(enabled: bool) {
+    ENABLED.store(enabled, Ordering::SeqCst);
+}
+
+pub fn rs_reaper_is_enabled() -> bool {
+    ENABLED.load(Ordering::SeqCst)
+}
+
+/// Number of deferred drops that have not finished yet.
+pub fn rs_reaper_pending() -> usize {
+    PENDING.load(Ordering::SeqCst)
+}
+
+/// Block until every drop deferred so far has finished.
+pub fn rs_reaper_flush() {
+    let _flushing = FLUSH.lock().unwrap_or_else(|e| e.into_inner());
+    let tasks = TASKS.lock().unwrap_or_else(|e| e.into_inner()).take();
+    if let Some(mut tasks) = tasks {
+        runtime().block_on(async move { while tasks.join_next().await.is_some() {} });
+    }
+}
+
+/// Disable deferral and wait for the queue, drops from now on block again.
+pub fn rs_reaper_drain() {
+    rs_reaper_set_enabled(false);
+    rs_reaper_flush();
+}
+
+/// Drops value on the blocking pool of the runtime when deferred removal is enabled,
+/// otherwise hands it back to be dropped by the caller.
+///
+/// The drop itself is unchanged: ContainerAsync still removes the container, or keeps it
+/// when it is reused, it just happens off the caller's thread.
+pub fn defer_drop<T: Send + 'static>(value: T) -> Option<T> {
+    if !rs_reaper_is_enabled() {
+        return Some(value);
+    }
+
+    PENDING.fetch_add(1, Ordering::SeqCst);
+    let mut tasks = TASKS.lock().unwrap_or_else(|e| e.into_inner());
+    let tasks = tasks.get_or_insert_with(JoinSet::new);
+    // Forget finished drops so the set does not grow between flushes
+    while tasks.try_join_next().is_some() {}
+    tasks.spawn_blocking_on(
+        move || {
+            drop(value);
+            PENDING.fetch_sub(1, Ordering::SeqCst);
+        },
+        runtime().handle(),
+    );
+    None
+}
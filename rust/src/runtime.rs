@@ -0,0 +1,35 @@
+use std::sync::{Mutex, OnceLock};
+use tokio::runtime::{Builder, Runtime};
+
+static RUNTIME: OnceLock<Runtime> = OnceLock::new();
+static WORKER_THREADS: Mutex<Option<usize>> = Mutex::new(None);
+
+/// Set the number of worker threads of the shared runtime.
+/// Must be called before the first container operation.
+pub fn rs_runtime_configure(worker_threads: usize) -> Result<(), String> {
+    if worker_threads == 0 {
+        return Err("Failed to configure runtime: worker_threads must be greater than 0".to_string());
+    }
+    let mut configured = WORKER_THREADS
+        .lock()
+        .map_err(|e| format!("Failed to configure runtime: {}", e))?;
+    if RUNTIME.get().is_some() {
+        return Err("Failed to configure runtime: runtime is already running".to_string());
+    }
+    *configured = Some(worker_threads);
+    Ok(())
+}
+
+/// Process-wide runtime shared by every container, request and image.
+/// Created lazily on first use.
+pub fn runtime() -> &'static Runtime {
+    RUNTIME.get_or_init(|| {
+        let worker_threads = *WORKER_THREADS.lock().unwrap_or_else(|e| e.into_inner());
+        let mut builder = Builder::new_multi_thread();
+        builder.thread_name("testcontainers-worker").enable_all();
+        if let Some(worker_threads) = worker_threads {
+            builder.worker_threads(worker_threads);
+        }
+        builder.build().expect("Failed to build tokio runtime")
+    })
+}
@@ -0,0 +1,17 @@
+pub struct RsBytes {
+    bytes: Vec<u8>,
+}
+
+pub fn rs_bytes_destroy(bytes: Box<RsBytes>) {
+    drop(bytes);
+}
+
+impl RsBytes {
+    pub fn new(bytes: Vec<u8>) -> Self {
+        Self { bytes }
+    }
+
+    pub fn rs_bytes_as_slice(self: &RsBytes) -> &[u8] {
+        &self.bytes
+    }
+}
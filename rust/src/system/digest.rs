@@ -0,0 +1,40 @@
+const FNV_OFFSET_BASIS: u128 = 0x6c62272e07bb014262b821756295c58d;
+const FNV_PRIME: u128 = 0x0000000001000000000000000000013b;
+
+/// 128-bit FNV-1a. Unlike DefaultHasher the result is the same in every process and on every
+/// Rust release, so it can name things that outlive the process, like reusable containers.
+pub struct StableHasher {
+    state: u128,
+}
+
+impl StableHasher {
+    pub fn new() -> Self {
+        Self {
+            state: FNV_OFFSET_BASIS,
+        }
+    }
+
+    pub fn write(&mut self, bytes: &[u8]) {
+        for byte in bytes {
+            self.state ^= u128::from(*byte);
+            self.state = self.state.wrapping_mul(FNV_PRIME);
+        }
+    }
+
+    /// Writes one field, length-prefixed so that ("ab", "c") and ("a", "bc") differ.
+    pub fn write_field(&mut self, field: &str) {
+        self.write(&(field.len() as u64).to_le_bytes());
+        self.write(field.as_bytes());
+    }
+
+    pub fn finish(&self) -> String {
+        format!("{:032x}", self.state)
+    }
+}
+
+/// Digest of content that is too large to be part of a key itself.
+pub fn digest(bytes: &[u8]) -> String {
+    let mut hasher = StableHasher::new();
+    hasher.write(bytes);
+    hasher.finish()
+}
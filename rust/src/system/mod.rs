@@ -1,3 +1,5 @@
+pub mod bytes;
 pub mod url_host;
 pub mod path;
 pub mod ip;
+pub mod digest;
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <testcontainers/testcontainers.hpp>
+
+using namespace testcontainers;
+
+namespace {
+
+std::vector<std::pair<std::string, std::string>> make_env(std::int64_t count) {
+  std::vector<std::pair<std::string, std::string>> env;
+  for (std::int64_t i = 0; i < count; ++i) {
+    env.emplace_back("VAR_" + std::to_string(i), "value_" + std::to_string(i));
+  }
+  return env;
+}
+
+} // namespace
+
+// ============================================================================
+// Builder Chains
+// ============================================================================
+
+static void BM_GenericImageNew(benchmark::State &state) {
+  for (auto _ : state) {
+    auto image = GenericImage("alpine", "latest");
+    benchmark::DoNotOptimize(image);
+  }
+}
+BENCHMARK(BM_GenericImageNew);
+
+// One bridge round trip per with_* call, range(0) env vars on top of a typical chain
+static void BM_BuilderChain(benchmark::State &state) {
+  auto env = make_env(state.range(0));
+  for (auto _ : state) {
+    auto request = GenericImage("redis", "7.2.4")
+                       .with_exposed_port(ContainerPort::Tcp(6379))
+                       .with_wait_for(WaitFor::message_on_stdout("Ready to accept connections"))
+                       .with_cmd({"redis-server", "--save", ""});
+    for (const auto &[name, value] : env) {
+      request = request.with_env_var(name, value);
+    }
+    benchmark::DoNotOptimize(request);
+  }
+  state.SetItemsProcessed(state.iterations() * (state.range(0) + 4));
+}
+BENCHMARK(BM_BuilderChain)->Arg(0)->Arg(8)->Arg(64);
+
+// The same request as BM_BuilderChain built from a ContainerSpec in a single call
+static void BM_ContainerSpecFromSpec(benchmark::State &state) {
+  ContainerSpec spec{
+      .name = "redis",
+      .tag = "7.2.4",
+      .cmd = {"redis-server", "--save", ""},
+      .exposed_ports = {{6379}},
+      .env_vars = make_env(state.range(0)),
+  };
+  for (auto _ : state) {
+    auto request = ContainerRequest::from_spec(spec).with_ready_conditions(
+        {WaitFor::message_on_stdout("Ready to accept connections")});
+    benchmark::DoNotOptimize(request);
+  }
+}
+BENCHMARK(BM_ContainerSpecFromSpec)->Arg(0)->Arg(8)->Arg(64);
+
+static void BM_ContainerRequestClone(benchmark::State &state) {
+  auto base = GenericImage("redis", "7.2.4")
+                  .with_exposed_port(ContainerPort::Tcp(6379))
+                  .with_env_var("REDIS_ARGS", "--save ''");
+  for (auto _ : state) {
+    auto request = base.clone();
+    benchmark::DoNotOptimize(request);
+  }
+}
+BENCHMARK(BM_ContainerRequestClone);
+
+static void BM_ContainerRequestSpecKey(benchmark::State &state) {
+  auto request = GenericImage("redis", "7.2.4").with_env_var("REDIS_ARGS", "--save ''");
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(request.spec_key());
+  }
+}
+BENCHMARK(BM_ContainerRequestSpecKey);
+
+// ============================================================================
+// Wait Conditions
+// ============================================================================
+
+static void BM_WaitForMessage(benchmark::State &state) {
+  for (auto _ : state) {
+    auto wait = WaitFor::message_on_stdout("Ready to accept connections");
+    benchmark::DoNotOptimize(wait);
+  }
+}
+BENCHMARK(BM_WaitForMessage);
+
+// Includes compiling the expression
+static void BM_WaitForRegex(benchmark::State &state) {
+  for (auto _ : state) {
+    auto wait = WaitFor::Log(LogWaitStrategy::std_out_regex(R"(\[\d+\] ready in \d+ms$)"));
+    benchmark::DoNotOptimize(wait);
+  }
+}
+BENCHMARK(BM_WaitForRegex);
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <testcontainers/testcontainers.hpp>
+
+using namespace testcontainers;
+
+namespace {
+
+GenericImage alpine() { return GenericImage("alpine", "latest"); }
+
+} // namespace
+
+// ============================================================================
+// Start / Stop
+// ============================================================================
+
+// Create, start and remove one container, the image is pulled before timing starts
+static void BM_StartRemove(benchmark::State &state) {
+  Container::rm(alpine().with_cmd({"sleep", "300"}).start());
+  for (auto _ : state) {
+    auto container = alpine().with_cmd({"sleep", "300"}).start();
+    Container::rm(std::move(container));
+  }
+}
+BENCHMARK(BM_StartRemove)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_StartStop(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto container = alpine().with_cmd({"sleep", "300"}).start();
+    state.ResumeTiming();
+
+    container.stop_with_timeout(0);
+
+    state.PauseTiming();
+    Container::rm(std::move(container));
+    state.ResumeTiming();
+  }
+}
+BENCHMARK(BM_StartStop)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// range(0) containers started concurrently with start_all
+static void BM_StartAll(benchmark::State &state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::vector<ContainerRequest> requests;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      requests.push_back(alpine().with_cmd({"sleep", "300"}));
+    }
+    state.ResumeTiming();
+
+    auto containers = ContainerRequest::start_all(std::move(requests));
+    benchmark::DoNotOptimize(containers);
+
+    state.PauseTiming();
+    containers.clear();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StartAll)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// ============================================================================
+// Exec
+// ============================================================================
+
+static void BM_Exec(benchmark::State &state) {
+  auto container = alpine().with_cmd({"sleep", "300"}).start();
+  for (auto _ : state) {
+    auto result = container.exec(ExecCommand({"true"}));
+    // The exec only completes once its output has been drained
+    benchmark::DoNotOptimize(result.stdout_bytes());
+    benchmark::DoNotOptimize(result.exit_code());
+  }
+}
+BENCHMARK(BM_Exec)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// range(0) execs in flight at once on one container
+static void BM_ExecAsync(benchmark::State &state) {
+  auto container = alpine().with_cmd({"sleep", "300"}).start();
+  for (auto _ : state) {
+    std::vector<Future<SyncExecResult>> futures;
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      futures.push_back(container.exec_async(ExecCommand({"true"})));
+    }
+    for (auto &future : futures) {
+      auto result = future.get();
+      benchmark::DoNotOptimize(result.stdout_bytes());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ExecAsync)->Arg(1)->Arg(8)->Arg(32)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <testcontainers/testcontainers.hpp>
+
+using namespace testcontainers;
+
+namespace {
+
+constexpr std::int64_t KiB = 1024;
+constexpr std::int64_t MiB = 1024 * KiB;
+
+ExecCommand write_bytes(std::int64_t size) {
+  return ExecCommand({"head", "-c", std::to_string(size), "/dev/zero"});
+}
+
+Container started_sleeper() {
+  return GenericImage("alpine", "latest").with_cmd({"sleep", "300"}).start();
+}
+
+// Prints size bytes to stdout once, then idles so the logs can be read repeatedly
+Container started_printer(std::int64_t size) {
+  auto script = "head -c " + std::to_string(size) + " /dev/zero && echo done && sleep 300";
+  return GenericImage("alpine", "latest")
+      .with_wait_for(WaitFor::message_on_stdout("done"))
+      .with_cmd({"sh", "-c", script})
+      .start();
+}
+
+} // namespace
+
+// ============================================================================
+// Exec Output
+// ============================================================================
+
+static void BM_ExecStdoutBytes(benchmark::State &state) {
+  auto container = started_sleeper();
+  for (auto _ : state) {
+    auto result = container.exec(write_bytes(state.range(0)));
+    auto bytes = result.stdout_bytes();
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ExecStdoutBytes)
+    ->Arg(KiB)
+    ->Arg(MiB)
+    ->Arg(16 * MiB)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_ExecStdoutToVec(benchmark::State &state) {
+  auto container = started_sleeper();
+  for (auto _ : state) {
+    auto result = container.exec(write_bytes(state.range(0)));
+    auto bytes = result.stdout_to_vec();
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ExecStdoutToVec)
+    ->Arg(KiB)
+    ->Arg(MiB)
+    ->Arg(16 * MiB)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// ============================================================================
+// Container Logs
+// ============================================================================
+
+static void BM_LogsStdoutBytes(benchmark::State &state) {
+  auto container = started_printer(state.range(0));
+  for (auto _ : state) {
+    auto bytes = container.stdout_bytes();
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LogsStdoutBytes)->Arg(KiB)->Arg(MiB)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_LogsStdoutToString(benchmark::State &state) {
+  auto container = started_printer(state.range(0));
+  for (auto _ : state) {
+    auto text = container.stdout_to_string();
+    benchmark::DoNotOptimize(text.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LogsStdoutToString)->Arg(KiB)->Arg(MiB)->Unit(benchmark::kMillisecond)->UseRealTime();
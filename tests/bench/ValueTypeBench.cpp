@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+
+#include <testcontainers/testcontainers.hpp>
+
+using namespace testcontainers;
+
+// ============================================================================
+// ContainerPort
+// ============================================================================
+
+static void BM_ContainerPortTcp(benchmark::State &state) {
+  for (auto _ : state) {
+    auto port = ContainerPort::Tcp(8080);
+    benchmark::DoNotOptimize(port);
+  }
+}
+BENCHMARK(BM_ContainerPortTcp);
+
+static void BM_ContainerPortGetter(benchmark::State &state) {
+  auto port = ContainerPort::Udp(5353);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(port.as_u16());
+  }
+}
+BENCHMARK(BM_ContainerPortGetter);
+
+// ============================================================================
+// Ipv4Addr
+// ============================================================================
+
+static void BM_Ipv4AddrFromOctets(benchmark::State &state) {
+  const std::array<std::uint8_t, 4> octets{192, 168, 1, 10};
+  for (auto _ : state) {
+    auto addr = Ipv4Addr::from_octets(octets);
+    benchmark::DoNotOptimize(addr);
+  }
+}
+BENCHMARK(BM_Ipv4AddrFromOctets);
+
+static void BM_Ipv4AddrToString(benchmark::State &state) {
+  auto addr = Ipv4Addr(192, 168, 1, 10);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(addr.to_string());
+  }
+}
+BENCHMARK(BM_Ipv4AddrToString);
+
+// ============================================================================
+// UrlHost
+// ============================================================================
+
+static void BM_UrlHostDomain(benchmark::State &state) {
+  for (auto _ : state) {
+    auto host = UrlHost::domain("registry.example.com");
+    benchmark::DoNotOptimize(host);
+  }
+}
+BENCHMARK(BM_UrlHostDomain);
+
+static void BM_UrlHostFromIpv4(benchmark::State &state) {
+  for (auto _ : state) {
+    auto host = UrlHost::from_ipv4(Ipv4Addr::localhost());
+    benchmark::DoNotOptimize(host);
+  }
+}
+BENCHMARK(BM_UrlHostFromIpv4);
+
+static void BM_UrlHostToString(benchmark::State &state) {
+  auto host = UrlHost::domain("registry.example.com");
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(host.to_string());
+  }
+}
+BENCHMARK(BM_UrlHostToString);
@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifndef _WIN32
+#include "testutils/DockerStub.hpp"
+#endif
+
+namespace {
+
+#ifndef _WIN32
+using testcontainers::test_utils::DockerStub;
+
+// Output of the shell commands the macro benchmarks run: `head -c N /dev/zero` and `echo text`,
+// optionally joined with &&
+DockerStub::Output emulate(const std::vector<std::string> &cmd) {
+  std::string script;
+  if (cmd.size() == 3 && cmd[0] == "sh" && cmd[1] == "-c") {
+    script = cmd[2];
+  } else {
+    for (const auto &arg : cmd) {
+      script += arg + " ";
+    }
+  }
+  DockerStub::Output output;
+  std::string_view rest = script;
+  while (!rest.empty()) {
+    auto end = rest.find("&&");
+    auto part = rest.substr(0, end);
+    part.remove_prefix(std::min(part.find_first_not_of(' '), part.size()));
+    if (part.rfind("head -c ", 0) == 0) {
+      output.out.append(std::stoull(std::string(part.substr(8))), '\0');
+    } else if (part.rfind("echo ", 0) == 0) {
+      auto text = part.substr(5);
+      output.out.append(text.substr(0, text.find_last_not_of(' ') + 1)).append("\n");
+    }
+    rest = end == std::string_view::npos ? std::string_view() : rest.substr(end + 2);
+  }
+  return output;
+}
+
+// Started before the library makes its first Docker call, so DOCKER_HOST is already set
+std::unique_ptr<DockerStub> start_stub(std::chrono::milliseconds latency) {
+  auto stub = std::make_unique<DockerStub>();
+  stub->set_latencies({latency, latency, latency, latency, latency, latency, latency});
+  stub->set_on_start(emulate);
+  stub->set_on_exec(emulate);
+  setenv("DOCKER_HOST", stub->docker_host().c_str(), 1);
+  return stub;
+}
+#endif
+
+} // namespace
+
+/**
+ * @brief Benchmark main with an optional Docker API stub
+ *
+ * --stub (or TESTCONTAINERS_BENCH_STUB=1) runs the benchmarks against an in-process DockerStub
+ * instead of the daemon, so they measure the library alone. --stub_latency_ms=<n> adds a fixed
+ * delay to every stubbed request. All other flags go to Google Benchmark.
+ */
+int main(int argc, char **argv) {
+  const char *env = std::getenv("TESTCONTAINERS_BENCH_STUB");
+  bool use_stub = env != nullptr && std::string_view(env) == "1";
+  long latency_ms = 0;
+
+  std::vector<char *> args;
+  for (int i = 0; i < argc; ++i) {
+    std::string_view arg = argv[i];
+    if (arg == "--stub") {
+      use_stub = true;
+    } else if (arg.rfind("--stub_latency_ms=", 0) == 0) {
+      use_stub = true;
+      latency_ms = std::atol(argv[i] + 18);
+    } else {
+      args.push_back(argv[i]);
+    }
+  }
+  int args_count = static_cast<int>(args.size());
+
+#ifndef _WIN32
+  std::unique_ptr<DockerStub> stub;
+  if (use_stub) {
+    stub = start_stub(std::chrono::milliseconds(latency_ms));
+    benchmark::AddCustomContext("docker", "stub, " + std::to_string(latency_ms) + "ms latency");
+  }
+#else
+  if (use_stub) {
+    std::fprintf(stderr, "--stub needs Unix sockets and is not available on Windows\n");
+    return 1;
+  }
+#endif
+
+  benchmark::Initialize(&args_count, args.data());
+  if (benchmark::ReportUnrecognizedArguments(args_count, args.data())) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "testutils/DockerStub.hpp"
+
+/// The stub DOCKER_HOST points to for the whole run, see main.cpp.
+testcontainers::test_utils::DockerStub &hermetic_stub();
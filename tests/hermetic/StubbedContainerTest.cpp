@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <testcontainers/testcontainers.hpp>
+
+#include "HermeticStub.hpp"
+
+using namespace testcontainers;
+using namespace testcontainers::test_utils;
+using namespace std::chrono_literals;
+
+namespace {
+
+class StubbedContainerTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    stub().set_latencies({});
+    stub().set_on_start({});
+    stub().set_on_exec({});
+  }
+
+  static DockerStub &stub() { return hermetic_stub(); }
+
+  // Nothing runs in the stub, a container keeps running until stopped
+  static GenericImage alpine() { return GenericImage("alpine", "latest"); }
+};
+
+} // namespace
+
+// ============================================================================
+// Lifecycle Tests
+// ============================================================================
+
+TEST_F(StubbedContainerTest, StartAndRemove) {
+  auto containers_before = stub().container_count();
+
+  auto container = alpine().start();
+  EXPECT_TRUE(container.is_running());
+  EXPECT_EQ(container.id().size(), 64);
+  EXPECT_EQ(stub().container_count(), containers_before + 1);
+
+  Container::rm(std::move(container));
+  EXPECT_EQ(stub().container_count(), containers_before);
+}
+
+TEST_F(StubbedContainerTest, StopReportsExitCode) {
+  auto container = alpine().start();
+
+  container.stop();
+  EXPECT_FALSE(container.is_running());
+  EXPECT_EQ(container.exit_code(), 137);
+}
+
+TEST_F(StubbedContainerTest, ExposedPortIsMapped) {
+  auto container = alpine().with_exposed_port(ContainerPort::Tcp(6379)).start();
+
+  EXPECT_GE(container.get_host_port_ipv4(ContainerPort::Tcp(6379)), 32768);
+}
+
+TEST_F(StubbedContainerTest, ExitWaitSeesExitedContainer) {
+  stub().set_on_start([](const std::vector<std::string> &) {
+    return DockerStub::Output{.out = "bye\n", .exit_code = 3};
+  });
+
+  auto container = alpine().with_wait_for(WaitFor::exit()).start();
+  EXPECT_FALSE(container.is_running());
+  EXPECT_EQ(container.exit_code(), 3);
+}
+
+// ============================================================================
+// Output Tests
+// ============================================================================
+
+TEST_F(StubbedContainerTest, LogWaitMatchesStartOutput) {
+  stub().set_on_start([](const std::vector<std::string> &) {
+    return DockerStub::Output{.out = "booting\nready\n", .err = "warning\n"};
+  });
+
+  auto container = alpine().with_wait_for(WaitFor::message_on_stdout("ready")).start();
+  EXPECT_EQ(container.stdout_to_string(), "booting\nready\n");
+  EXPECT_EQ(container.stderr_to_string(), "warning\n");
+}
+
+TEST_F(StubbedContainerTest, RegexLogWaitKeepsStreamsApart) {
+  // Joined across the two streams the output would read "ready"
+  stub().set_on_start([](const std::vector<std::string> &) {
+    return DockerStub::Output{.out = "rea", .err = "dy\n", .exit_code = 0};
+  });
+
+  auto image =
+      alpine().with_wait_for(WaitFor::Log(LogWaitStrategy::stdout_or_stderr_regex("^ready$")));
+  EXPECT_THROW(image.start(), Error);
+}
+
+TEST_F(StubbedContainerTest, RegexLogWaitDropsOverlongLines) {
+  // Longer than the line window, only its tail would match
+  stub().set_on_start([](const std::vector<std::string> &) {
+    return DockerStub::Output{.out = "ready" + std::string(100 * 1024, 'x'), .exit_code = 0};
+  });
+
+  auto image = alpine().with_wait_for(WaitFor::Log(LogWaitStrategy::std_out_regex("^x+$")));
+  EXPECT_THROW(image.start(), Error);
+}
+
+TEST_F(StubbedContainerTest, ExecReturnsHandlerOutput) {
+  stub().set_on_exec([](const std::vector<std::string> &cmd) {
+    return DockerStub::Output{.out = cmd.back(), .err = "", .exit_code = 7};
+  });
+  auto container = alpine().start();
+
+  auto result = container.exec(ExecCommand({"echo", "hello"}));
+  EXPECT_EQ(result.stdout_to_string(), "hello");
+  EXPECT_EQ(result.exit_code(), 7);
+}
+
+// ============================================================================
+// Latency Tests
+// ============================================================================
+
+TEST_F(StubbedContainerTest, StartLatencyIsMeasured) {
+  stub().set_latencies({.start = 200ms});
+
+  auto started_at = std::chrono::steady_clock::now();
+  auto container = alpine().start();
+  EXPECT_GE(std::chrono::steady_clock::now() - started_at, 200ms);
+}
+
+TEST_F(StubbedContainerTest, StartAllOverlapsStarts) {
+  constexpr int count = 4;
+  stub().set_latencies({.start = 300ms});
+  auto starts_before = stub().request_count("start");
+
+  std::vector<GenericImage> images;
+  for (int i = 0; i < count; ++i) {
+    images.push_back(alpine());
+  }
+  auto started_at = std::chrono::steady_clock::now();
+  auto containers = GenericImage::start_all(std::move(images));
+  auto elapsed = std::chrono::steady_clock::now() - started_at;
+
+  EXPECT_EQ(containers.size(), count);
+  EXPECT_EQ(stub().request_count("start"), starts_before + count);
+  // Sequential starts would take count * 300ms
+  EXPECT_LT(elapsed, count * 300ms);
+}
+
+// ============================================================================
+// Group Teardown Tests
+// ============================================================================
+
+TEST_F(StubbedContainerTest, GroupTeardownOverlapsStopAndRemove) {
+  constexpr int count = 4;
+  auto containers_before = stub().container_count();
+  auto stops_before = stub().request_count("stop");
+
+  ContainerGroup group;
+  for (int i = 0; i < count; ++i) {
+    group.add(alpine().start());
+  }
+  stub().set_latencies({.stop = 300ms, .remove = 100ms});
+
+  auto started_at = std::chrono::steady_clock::now();
+  group.teardown();
+  auto elapsed = std::chrono::steady_clock::now() - started_at;
+
+  EXPECT_EQ(stub().container_count(), containers_before);
+  EXPECT_EQ(stub().request_count("stop"), stops_before + count);
+  // Dropping the containers one by one would take count * 400ms
+  EXPECT_LT(elapsed, count * 400ms);
+}
+
+TEST_F(StubbedContainerTest, GroupTeardownLeavesReusableContainers) {
+  auto containers_before = stub().container_count();
+  auto stops_before = stub().request_count("stop");
+
+  ContainerGroup group;
+  group.add(alpine().with_reuse(ReuseDirective::Always()).start());
+  group.add(alpine().with_reuse(ReuseDirective::CurrentSession()).start());
+  group.add(alpine().start());
+  group.teardown();
+
+  // Only the member without a reuse directive is stopped and removed, as a drop would do
+  EXPECT_EQ(stub().container_count(), containers_before + 2);
+  EXPECT_EQ(stub().request_count("stop"), stops_before + 1);
+}
+
+// ============================================================================
+// Deferred Removal Tests
+// ============================================================================
+
+TEST_F(StubbedContainerTest, ReaperRemovesDroppedContainerInBackground) {
+  auto containers_before = stub().container_count();
+  auto container = std::make_optional(alpine().start());
+  stub().set_latencies({.remove = 300ms});
+
+  Reaper::enable();
+  auto dropped_at = std::chrono::steady_clock::now();
+  container.reset();
+  auto drop_time = std::chrono::steady_clock::now() - dropped_at;
+  Reaper::disable();
+
+  EXPECT_LT(drop_time, 300ms);
+  EXPECT_EQ(Reaper::pending(), 1);
+
+  Reaper::flush();
+  EXPECT_EQ(Reaper::pending(), 0);
+  EXPECT_EQ(stub().container_count(), containers_before);
+}
+
+TEST_F(StubbedContainerTest, DisabledReaperRemovesOnDrop) {
+  auto containers_before = stub().container_count();
+  {
+    auto container = alpine().start();
+  }
+  EXPECT_EQ(Reaper::pending(), 0);
+  EXPECT_EQ(stub().container_count(), containers_before);
+}
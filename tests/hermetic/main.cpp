@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <iostream>
+
+#include "HermeticStub.hpp"
+
+using testcontainers::test_utils::DockerStub;
+
+namespace {
+DockerStub *stub = nullptr;
+} // namespace
+
+DockerStub &hermetic_stub() { return *stub; }
+
+/**
+ * @brief Custom main function for hermetic tests
+ *
+ * The library connects to Docker once per process, so the stub is started and DOCKER_HOST
+ * set before any test touches a container. No Docker daemon is needed.
+ */
+int main(int argc, char **argv) {
+  DockerStub docker_stub;
+  stub = &docker_stub;
+  setenv("DOCKER_HOST", docker_stub.docker_host().c_str(), 1);
+
+  std::cout << "Docker API stub listening on " << docker_stub.docker_host() << std::endl;
+
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
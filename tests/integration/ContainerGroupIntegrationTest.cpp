@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <testcontainers/testcontainers.hpp>
+
+using namespace testcontainers;
+
+// sh as PID 1 ignores SIGTERM, so every stop runs into the stop timeout
+static ContainerRequest sleeper() {
+  return GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"});
+}
+
+static std::vector<ContainerRequest> sleepers(int count) {
+  std::vector<ContainerRequest> requests;
+  for (int i = 0; i < count; ++i) {
+    requests.push_back(sleeper());
+  }
+  return requests;
+}
+
+// ============================================================================
+// Membership Tests
+// ============================================================================
+
+TEST(ContainerGroupIntegrationTest, AddKeepsReferencesValid) {
+  ContainerGroup group;
+  const auto &first = group.add(sleeper().start());
+  auto first_id = first.id();
+  group.add(sleeper().start());
+  group.add(sleeper().start());
+
+  EXPECT_EQ(group.size(), 3);
+  EXPECT_EQ(first.id(), first_id);
+  EXPECT_EQ(group[0].id(), first_id);
+}
+
+TEST(ContainerGroupIntegrationTest, ReleaseSkipsTeardown) {
+  std::vector<Container> containers;
+  {
+    ContainerGroup group(ContainerRequest::start_all(sleepers(2)), {});
+    containers = group.release();
+    EXPECT_TRUE(group.empty());
+  }
+
+  ASSERT_EQ(containers.size(), 2);
+  for (const auto &container : containers) {
+    EXPECT_TRUE(container.is_running());
+  }
+}
+
+// ============================================================================
+// Teardown Tests
+// ============================================================================
+
+TEST(ContainerGroupIntegrationTest, TeardownEmptiesGroup) {
+  ContainerGroup group(ContainerRequest::start_all(sleepers(2)), {.stop_timeout_sec = 0});
+  group.teardown();
+  EXPECT_TRUE(group.empty());
+
+  // Nothing left to tear down
+  group.teardown();
+}
+
+TEST(ContainerGroupIntegrationTest, TeardownStopsMembersConcurrently) {
+  constexpr int count = 4;
+  constexpr int stop_timeout_sec = 2;
+  ContainerGroup group(ContainerRequest::start_all(sleepers(count)),
+                       {.stop_timeout_sec = stop_timeout_sec});
+
+  auto started_at = std::chrono::steady_clock::now();
+  group.teardown();
+  auto elapsed = std::chrono::steady_clock::now() - started_at;
+
+  // One stop after the other would take count * stop_timeout_sec
+  EXPECT_LT(elapsed, std::chrono::seconds(count * stop_timeout_sec));
+}
+
+TEST(ContainerGroupIntegrationTest, TeardownWithPendingExec) {
+  ContainerGroup group({.stop_timeout_sec = 0});
+  const auto &container = group.add(sleeper().start());
+  auto exec = container.exec_async(ExecCommand({"echo", "done"}));
+
+  group.teardown();
+  EXPECT_TRUE(group.empty());
+  exec.wait();
+}
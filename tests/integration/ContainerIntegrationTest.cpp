@@ -2,12 +2,25 @@
 #include <gtest/gtest.h>
 
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <fstream>
+#include <future>
+#include <iterator>
 #include <thread>
 
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#include <exception>
+#endif
+
 #include <testcontainers/testcontainers.hpp>
 
+#include "testutils/TempFile.hpp"
+
 using namespace testcontainers;
+using namespace testcontainers::test_utils;
 using ::testing::HasSubstr;
 
 // ============================================================================
@@ -138,6 +151,59 @@ TEST(ContainerIntegrationTest, ContainerMultilineStdout) {
   ASSERT_THAT(stdout_str, HasSubstr("Line 3"));
 }
 
+TEST(ContainerIntegrationTest, ContainerStdoutBytes) {
+  auto container
+      = GenericImage("alpine", "latest")
+            .with_cmd({"sh", "-c", "echo 'Bytes from stdout' && echo 'Bytes from stderr' >&2"})
+            .start();
+
+  EXPECT_THAT(std::string(container.stdout_bytes().view()), HasSubstr("Bytes from stdout"));
+  EXPECT_THAT(container.stderr_bytes().to_string(), HasSubstr("Bytes from stderr"));
+}
+
+TEST(ContainerIntegrationTest, ContainerStdoutStreamLines) {
+  auto container = GenericImage("alpine", "latest")
+                       .with_cmd({"sh", "-c", "echo 'Line 1' && echo 'Line 2' && echo 'Line 3'"})
+                       .start();
+
+  std::vector<std::string> lines;
+  auto stream = container.stdout_stream(true);
+  for (const auto &line : stream.lines()) {
+    lines.push_back(line);
+  }
+
+  EXPECT_THAT(lines, ::testing::ElementsAre("Line 1", "Line 2", "Line 3"));
+}
+
+TEST(ContainerIntegrationTest, ContainerStderrStreamRead) {
+  auto container = GenericImage("alpine", "latest")
+                       .with_cmd({"sh", "-c", "echo 'Error from stream' >&2"})
+                       .start();
+
+  auto stream = container.stderr_stream(true);
+  std::string output;
+  std::uint8_t buffer[4];
+  while (auto read = stream.read(buffer)) {
+    output.append(reinterpret_cast<const char *>(buffer), read);
+  }
+
+  ASSERT_THAT(output, HasSubstr("Error from stream"));
+}
+
+TEST(ContainerIntegrationTest, ContainerStdoutStreamFollowsRunningContainer) {
+  auto container
+      = GenericImage("alpine", "latest")
+            .with_cmd({"sh", "-c", "for i in 1 2 3; do echo tick $i; sleep 1; done; sleep 200"})
+            .start();
+
+  auto stream = container.stdout_stream(true);
+  std::string line;
+  for (int i = 1; i <= 3; ++i) {
+    ASSERT_TRUE(stream.read_line(line));
+    EXPECT_EQ(line, "tick " + std::to_string(i));
+  }
+}
+
 // ============================================================================
 // Container Port Mapping Tests
 // ============================================================================
@@ -214,6 +280,17 @@ TEST(ContainerIntegrationTest, ContainerExecSimpleCommand) {
   EXPECT_EQ(result.exit_code(), std::optional<std::int64_t>(0));
 }
 
+TEST(ContainerIntegrationTest, ContainerExecStdoutBytes) {
+  auto container = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
+
+  auto result = container.exec(ExecCommand({"sh", "-c", "head -c 1048576 /dev/zero"}));
+  auto bytes = result.stdout_bytes();
+
+  ASSERT_EQ(bytes.size(), 1048576u);
+  EXPECT_EQ(bytes.span().size(), bytes.view().size());
+  EXPECT_EQ(std::count(bytes.begin(), bytes.end(), std::uint8_t{0}), 1048576);
+}
+
 TEST(ContainerIntegrationTest, ContainerExecWithNonZeroExitCode) {
   auto container = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
   EXPECT_TRUE(container.is_running());
@@ -288,6 +365,19 @@ TEST(ContainerIntegrationTest, ContainerRemoveAfterExit) {
   EXPECT_FALSE(container.is_valid());
 }
 
+TEST(ContainerIntegrationTest, ReaperDefersRemovalUntilFlush) {
+  Reaper::enable();
+  {
+    auto container =
+        GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
+  }
+  Reaper::disable();
+
+  Reaper::flush();
+  EXPECT_EQ(Reaper::pending(), 0);
+  EXPECT_FALSE(Reaper::is_enabled());
+}
+
 // ============================================================================
 // Complex Scenarios
 // ============================================================================
@@ -381,3 +471,247 @@ TEST(ContainerIntegrationTest, ContainerWithEnvVarsAndExec) {
   ASSERT_THAT(stdout_str, HasSubstr("TEST_VAR"));
   ASSERT_THAT(stdout_str, HasSubstr("ANOTHER_VAR"));
 }
+
+// ============================================================================
+// Copy To Running Container Tests
+// ============================================================================
+
+TEST(ContainerIntegrationTest, CopyMappedFileToRunningContainer) {
+  const std::string content(3 * 1024 * 1024 + 7, 'x');
+  TempFile temp_file(content);
+
+  auto container = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
+  container.copy_to("/tmp/nested/dir/mapped.bin", CopyDataSource::MappedFile(temp_file.path()));
+
+  auto result = container.exec(ExecCommand({"wc", "-c", "/tmp/nested/dir/mapped.bin"}));
+  EXPECT_THAT(result.stdout_to_string(), HasSubstr(std::to_string(content.size())));
+}
+
+TEST(ContainerIntegrationTest, CopyDataToRunningContainer) {
+  auto container = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
+  container.copy_to("/tmp/data.txt", CopyDataSource::Data(std::string_view("copied data")));
+
+  auto result = container.exec(ExecCommand({"cat", "/tmp/data.txt"}));
+  EXPECT_EQ(result.stdout_to_string(), "copied data");
+}
+
+TEST(ContainerIntegrationTest, CopyMissingFileThrows) {
+  auto container = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
+  auto source = CopyDataSource::MappedFile("/nonexistent/file");
+  EXPECT_THROW(container.copy_to("/tmp/missing.bin", std::move(source)), Error);
+}
+
+// ============================================================================
+// Copy From Running Container Tests
+// ============================================================================
+
+TEST(ContainerIntegrationTest, CopyFileFromReadsInChunks) {
+  const std::string content(256 * 1024 + 13, 'y');
+  auto container = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
+  container.copy_to("/tmp/large.txt", CopyDataSource::Data(std::string_view(content)));
+
+  auto reader = container.copy_file_from("/tmp/large.txt");
+  ASSERT_TRUE(reader.is_valid());
+  EXPECT_EQ(reader.size(), content.size());
+
+  std::string received;
+  std::array<std::uint8_t, 4096> buffer{};
+  while (auto n = reader.read(buffer)) {
+    received.append(reinterpret_cast<const char *>(buffer.data()), n);
+  }
+  EXPECT_EQ(received, content);
+  EXPECT_EQ(reader.read(buffer), 0u);
+}
+
+TEST(ContainerIntegrationTest, CopyToHostWritesFile) {
+  TempFile host_file("");
+  auto container = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
+  container.copy_to("/tmp/data.txt", CopyDataSource::Data(std::string_view("copied back")));
+
+  container.copy_to_host("/tmp/data.txt", host_file.path());
+
+  std::ifstream ifs(host_file.path(), std::ios::binary);
+  std::string received((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+  EXPECT_EQ(received, "copied back");
+}
+
+TEST(ContainerIntegrationTest, CopyFileFromMissingPathThrows) {
+  auto container = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
+  EXPECT_THROW(container.copy_file_from("/tmp/does-not-exist"), Error);
+}
+
+TEST(ContainerIntegrationTest, CopyFileFromDirectoryThrows) {
+  auto container = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
+  EXPECT_THROW(container.copy_file_from("/etc"), Error);
+}
+
+// ============================================================================
+// Async Tests
+// ============================================================================
+
+TEST(ContainerIntegrationTest, StartAsyncConcurrently) {
+  auto first = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start_async();
+  auto second = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start_async();
+
+  auto first_container = first.get();
+  auto second_container = second.get();
+
+  EXPECT_FALSE(first.is_valid());
+  EXPECT_TRUE(first_container.is_running());
+  EXPECT_TRUE(second_container.is_running());
+}
+
+TEST(ContainerIntegrationTest, ExecAsync) {
+  auto container = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
+
+  auto future = container.exec_async(ExecCommand({"echo", "Hello from async exec"}));
+  future.wait();
+  EXPECT_TRUE(future.is_ready());
+
+  auto result = future.get();
+  ASSERT_THAT(result.stdout_to_string(), HasSubstr("Hello from async exec"));
+  EXPECT_EQ(result.exit_code(), std::optional<std::int64_t>(0));
+}
+
+TEST(ContainerIntegrationTest, StopAsync) {
+  auto container = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
+
+  auto future = container.stop_async();
+  EXPECT_TRUE(future.wait_for(std::chrono::seconds(30)));
+  future.get();
+
+  EXPECT_FALSE(container.is_running());
+}
+
+TEST(ContainerIntegrationTest, StartAsyncReportsErrorOnGet) {
+  auto future = GenericImage("nonexistent-image-xyz", "latest").start_async();
+  EXPECT_THROW(future.get(), Error);
+}
+
+// ============================================================================
+// Startup Profile Tests
+// ============================================================================
+
+TEST(ContainerIntegrationTest, StartupProfileTimesTestcontainersConditionsOneByOne) {
+  auto container = GenericImage("alpine", "latest")
+                       .with_wait_for(WaitFor::message_on_stdout("ready"))
+                       .with_wait_for(WaitFor::millis(100))
+                       .with_cmd({"sh", "-c", "sleep 1 && echo ready && sleep 200"})
+                       .start();
+
+  auto profile = container.startup_profile();
+  ASSERT_EQ(profile.conditions.size(), 2);
+  EXPECT_THAT(profile.conditions[0].description, HasSubstr("ready"));
+  EXPECT_GE(profile.conditions[0].duration, std::chrono::milliseconds(500));
+  EXPECT_THAT(profile.conditions[1].description, HasSubstr("duration"));
+  EXPECT_EQ(profile.conditions[1].duration, std::chrono::milliseconds(100));
+}
+
+TEST(ContainerIntegrationTest, StartupProfileIsKeptAcrossRestarts) {
+  auto container = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
+
+  auto profile = container.startup_profile();
+  container.stop_with_timeout(0);
+  container.start();
+
+  auto again = container.startup_profile();
+  EXPECT_EQ(again.create, profile.create);
+  EXPECT_EQ(again.start, profile.start);
+}
+
+TEST(ContainerIntegrationTest, StartupProfileTimesNativeConditions) {
+  auto container =
+      GenericImage("alpine", "latest")
+          .with_wait_for(WaitFor::Log(LogWaitStrategy::std_out_regex(R"(^ready \d+$)")))
+          .with_cmd({"sh", "-c", "sleep 1 && echo ready 1 && sleep 200"})
+          .start();
+
+  auto profile = container.startup_profile();
+  ASSERT_EQ(profile.conditions.size(), 1);
+  EXPECT_THAT(profile.conditions[0].description, HasSubstr("ready"));
+  EXPECT_GE(profile.conditions[0].duration, std::chrono::milliseconds(500));
+  EXPECT_GE(profile.total, profile.start + profile.conditions[0].duration);
+}
+
+TEST(ContainerIntegrationTest, StartupProfileOfAsyncStart) {
+  auto container =
+      GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start_async().get();
+
+  auto profile = container.startup_profile();
+  EXPECT_TRUE(profile.conditions.empty());
+  EXPECT_GT(profile.total.count(), 0);
+}
+
+#if defined(__cpp_impl_coroutine)
+
+// ============================================================================
+// Coroutine Tests
+// ============================================================================
+
+namespace {
+
+// Eagerly started coroutine reporting completion through a std::promise
+struct Task {
+  struct promise_type {
+    std::promise<void> done;
+
+    Task get_return_object() { return Task{done.get_future()}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() { done.set_value(); }
+    void unhandled_exception() { done.set_exception(std::current_exception()); }
+  };
+
+  std::future<void> done;
+};
+
+Task start_and_exec(std::string &output, bool &was_running) {
+  auto image = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"});
+  auto container = co_await image.start_async();
+  was_running = container.is_running();
+
+  auto command = ExecCommand({"echo", "Hello from coroutine"});
+  auto result = co_await container.exec_async(std::move(command));
+  output = result.stdout_to_string();
+
+  co_await container.stop_async();
+}
+
+Task start_nonexistent() {
+  co_await GenericImage("nonexistent-image-xyz", "latest").start_async();
+}
+
+} // namespace
+
+TEST(ContainerIntegrationTest, CoAwaitStartExecStop) {
+  std::string output;
+  bool was_running = false;
+
+  auto task = start_and_exec(output, was_running);
+  ASSERT_EQ(task.done.wait_for(std::chrono::minutes(2)), std::future_status::ready);
+  task.done.get();
+
+  EXPECT_TRUE(was_running);
+  ASSERT_THAT(output, HasSubstr("Hello from coroutine"));
+}
+
+TEST(ContainerIntegrationTest, CoAwaitPropagatesError) {
+  auto task = start_nonexistent();
+  ASSERT_EQ(task.done.wait_for(std::chrono::minutes(2)), std::future_status::ready);
+  EXPECT_THROW(task.done.get(), Error);
+}
+
+TEST(ContainerIntegrationTest, OnReadyCallback) {
+  auto container = GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}).start();
+
+  std::promise<void> called;
+  auto future = container.exec_async(ExecCommand({"true"}));
+  future.on_ready([&called] { called.set_value(); });
+
+  auto called_future = called.get_future();
+  ASSERT_EQ(called_future.wait_for(std::chrono::seconds(30)), std::future_status::ready);
+  EXPECT_TRUE(future.is_ready());
+  EXPECT_EQ(future.get().exit_code(), std::optional<std::int64_t>(0));
+}
+
+#endif
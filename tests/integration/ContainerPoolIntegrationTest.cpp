@@ -0,0 +1,109 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include <testcontainers/testcontainers.hpp>
+
+using namespace testcontainers;
+
+using ::testing::HasSubstr;
+
+static ContainerRequest sleeper() {
+  return GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"});
+}
+
+static bool wait_ready(const ContainerPool &pool, std::size_t count) {
+  for (int i = 0; i < 300; ++i) {
+    if (pool.ready(sleeper) >= count) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  return false;
+}
+
+// ============================================================================
+// Lease Tests
+// ============================================================================
+
+TEST(ContainerPoolIntegrationTest, LeaseStartsContainer) {
+  ContainerPool pool({.warm = 0});
+  auto lease = pool.lease(sleeper);
+  ASSERT_TRUE(lease.is_valid());
+  EXPECT_TRUE(lease->is_running());
+}
+
+TEST(ContainerPoolIntegrationTest, PrewarmKeepsContainersReady) {
+  ContainerPool pool({.warm = 2});
+  pool.prewarm(sleeper);
+  ASSERT_TRUE(wait_ready(pool, 2));
+
+  auto lease = pool.lease(sleeper);
+  EXPECT_TRUE(lease->is_running());
+  EXPECT_TRUE(wait_ready(pool, 2));
+}
+
+TEST(ContainerPoolIntegrationTest, ConcurrentLeasesAreDistinct) {
+  ContainerPool pool({.warm = 2});
+  auto first = pool.lease(sleeper);
+  auto second = pool.lease(sleeper);
+  EXPECT_NE(first->id(), second->id());
+}
+
+// ============================================================================
+// Return Tests
+// ============================================================================
+
+TEST(ContainerPoolIntegrationTest, ResetContainerIsReused) {
+  ContainerPool pool({.warm = 1, .reset_cmd = {"rm", "-f", "/tmp/state"}});
+
+  std::string id;
+  {
+    auto lease = pool.lease(sleeper);
+    id = lease->id();
+    lease->exec(ExecCommand({"touch", "/tmp/state"}));
+  }
+  ASSERT_TRUE(wait_ready(pool, 1));
+
+  auto lease = pool.lease(sleeper);
+  EXPECT_EQ(lease->id(), id);
+  auto result = lease->exec(ExecCommand({"sh", "-c", "ls /tmp/state || echo missing"}));
+  EXPECT_THAT(result.stdout_to_string(), HasSubstr("missing"));
+}
+
+TEST(ContainerPoolIntegrationTest, DiscardedContainerIsReplaced) {
+  ContainerPool pool({.warm = 1, .reset_cmd = {"true"}});
+
+  std::string id;
+  {
+    auto lease = pool.lease(sleeper);
+    id = lease->id();
+    lease.discard();
+    EXPECT_FALSE(lease.is_valid());
+  }
+  ASSERT_TRUE(wait_ready(pool, 1));
+
+  auto lease = pool.lease(sleeper);
+  EXPECT_NE(lease->id(), id);
+}
+
+TEST(ContainerPoolIntegrationTest, LeaseOutlivesPool) {
+  std::optional<ContainerPool::Lease> lease;
+  {
+    ContainerPool pool({.warm = 1});
+    lease.emplace(pool.lease(sleeper));
+  }
+  EXPECT_TRUE(lease->container().is_running());
+  lease->release();
+  EXPECT_FALSE(lease->is_valid());
+}
+
+TEST(ContainerPoolIntegrationTest, StartFailureIsReported) {
+  ContainerPool pool({.warm = 0});
+  EXPECT_THROW(pool.lease([] { return GenericImage("nonexistent/image", "invalid").with_cmd({}); }),
+               Error);
+}
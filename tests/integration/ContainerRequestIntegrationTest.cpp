@@ -1,6 +1,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <mutex>
+#include <thread>
+
 #include "testutils/TempFile.hpp"
 #include <testcontainers/testcontainers.hpp>
 
@@ -192,6 +196,72 @@ TEST(ContainerRequestIntegrationTest, RequestWithComplexHealthcheck) {
   EXPECT_TRUE(container.is_running());
 }
 
+TEST(ContainerRequestIntegrationTest, RequestWithEventDrivenHealthWait) {
+  auto healthcheck = Healthcheck::cmd_shell("test -f /tmp/ready")
+                         .with_interval(std::chrono::milliseconds(200))
+                         .with_retries(50);
+
+  // The fallback poll alone would notice the health change 30s late
+  auto wait = HealthWaitStrategy::healthcheck()
+                  .with_poll_interval(std::chrono::seconds(30))
+                  .with_events();
+
+  auto container = GenericImage("alpine", "latest")
+                       .with_health_check(std::move(healthcheck))
+                       .with_ready_conditions({WaitFor::Healthcheck(std::move(wait))})
+                       .with_cmd({"sh", "-c", "sleep 1 && touch /tmp/ready && sleep 200"})
+                       .with_startup_timeout(std::chrono::seconds(20))
+                       .start();
+
+  EXPECT_TRUE(container.is_running());
+}
+
+TEST(ContainerRequestIntegrationTest, RequestWithEventDrivenExitWait) {
+  auto container =
+      GenericImage("alpine", "latest")
+          .with_ready_conditions({WaitFor::Exit(ExitWaitStrategy::exit()
+                                                    .with_exit_code(0)
+                                                    .with_poll_interval(std::chrono::seconds(30))
+                                                    .with_events())})
+          .with_cmd({"sh", "-c", "sleep 1"})
+          .with_startup_timeout(std::chrono::seconds(20))
+          .start();
+
+  EXPECT_FALSE(container.is_running());
+}
+
+TEST(ContainerRequestIntegrationTest, RequestWithBackoffHealthWait) {
+  auto healthcheck = Healthcheck::cmd_shell("test -f /tmp/ready")
+                         .with_interval(std::chrono::milliseconds(100))
+                         .with_retries(50);
+  auto wait = HealthWaitStrategy::healthcheck()
+                  .with_poll_backoff(std::chrono::milliseconds(5), 2.0, std::chrono::seconds(1))
+                  .with_poll_jitter(0.2);
+
+  auto container = GenericImage("alpine", "latest")
+                       .with_health_check(std::move(healthcheck))
+                       .with_ready_conditions({WaitFor::Healthcheck(std::move(wait))})
+                       .with_cmd({"sh", "-c", "sleep 1 && touch /tmp/ready && sleep 200"})
+                       .with_startup_timeout(std::chrono::seconds(20))
+                       .start();
+
+  EXPECT_TRUE(container.is_running());
+}
+
+TEST(ContainerRequestIntegrationTest, RequestWithBackoffExitWait) {
+  auto wait = ExitWaitStrategy::exit().with_exit_code(0).with_poll_backoff(
+      std::chrono::milliseconds(1), 1.5, std::chrono::milliseconds(200));
+
+  auto container =
+      GenericImage("alpine", "latest")
+          .with_ready_conditions({WaitFor::Exit(std::move(wait))})
+          .with_cmd({"sh", "-c", "sleep 1"})
+          .with_startup_timeout(std::chrono::seconds(20))
+          .start();
+
+  EXPECT_FALSE(container.is_running());
+}
+
 // ============================================================================
 // Copy Files Configuration
 // ============================================================================
@@ -226,6 +296,19 @@ TEST(ContainerRequestIntegrationTest, RequestWithCopyMultipleFiles) {
   EXPECT_THAT(stdout_str, HasSubstr(content2));
 }
 
+TEST(ContainerRequestIntegrationTest, RequestWithCopyMappedFile) {
+  std::string test_content = "Mapped file content for container";
+  TempFile temp_file(test_content);
+
+  auto container
+      = GenericImage("alpine", "latest")
+            .with_copy_to("/tmp/mapped_file.txt", CopyDataSource::MappedFile(temp_file.path()))
+            .with_cmd({"sh", "-c", "cat /tmp/mapped_file.txt"})
+            .start();
+
+  EXPECT_THAT(container.stdout_to_string(), HasSubstr(test_content));
+}
+
 // ============================================================================
 // Ready Conditions
 // ============================================================================
@@ -282,6 +365,111 @@ TEST(ContainerRequestIntegrationTest, PullWithConfiguration) {
   EXPECT_THAT(container.stdout_to_string(), HasSubstr("test_value"));
 }
 
+// ============================================================================
+// Log Consumer
+// ============================================================================
+
+TEST(ContainerRequestIntegrationTest, LogConsumerReceivesTaggedFrames) {
+  std::mutex mutex;
+  std::string out;
+  std::string err;
+
+  auto consumer = [&](std::span<const LogFrame> frames) {
+    std::lock_guard lock(mutex);
+    for (const auto &frame : frames) {
+      (frame.source == LogSource::Stdout ? out : err).append(frame.text());
+    }
+  };
+
+  auto container
+      = GenericImage("alpine", "latest")
+            .with_cmd({"sh", "-c", "echo 'to stdout' && echo 'to stderr' >&2 && sleep 200"})
+            .with_log_consumer(consumer)
+            .start();
+
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+  while (std::chrono::steady_clock::now() < deadline) {
+    {
+      std::lock_guard lock(mutex);
+      if (out.find("to stdout") != std::string::npos
+          && err.find("to stderr") != std::string::npos) {
+        break;
+      }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+
+  std::lock_guard lock(mutex);
+  EXPECT_THAT(out, HasSubstr("to stdout"));
+  EXPECT_THAT(err, HasSubstr("to stderr"));
+  EXPECT_THAT(out, ::testing::Not(HasSubstr("to stderr")));
+}
+
+// ============================================================================
+// Batch Start
+// ============================================================================
+
+TEST(ContainerRequestIntegrationTest, StartAllPreservesOrder) {
+  std::vector<ContainerRequest> requests;
+  for (int i = 0; i < 4; ++i) {
+    requests.push_back(GenericImage("alpine", "latest")
+                           .with_env_var("INDEX", std::to_string(i))
+                           .with_cmd({"sh", "-c", "echo index=$INDEX && sleep 200"})
+                           .with_ready_conditions({WaitFor::message_on_stdout("index=")}));
+  }
+
+  auto containers = ContainerRequest::start_all(std::move(requests));
+
+  ASSERT_EQ(containers.size(), 4);
+  for (std::size_t i = 0; i < containers.size(); ++i) {
+    EXPECT_TRUE(containers[i].is_running());
+    EXPECT_THAT(containers[i].stdout_to_string(), HasSubstr("index=" + std::to_string(i)));
+  }
+}
+
+TEST(ContainerRequestIntegrationTest, TryStartAllReportsPerRequestErrors) {
+  std::vector<ContainerRequest> requests;
+  requests.push_back(GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}));
+  requests.push_back(
+      GenericImage("testcontainers-cxx-nonexistent-image", "latest").with_cmd({"true"}));
+
+  auto results = ContainerRequest::try_start_all(std::move(requests));
+
+  ASSERT_EQ(results.size(), 2);
+  ASSERT_TRUE(std::holds_alternative<Container>(results[0]));
+  EXPECT_TRUE(std::get<Container>(results[0]).is_running());
+  EXPECT_TRUE(std::holds_alternative<Error>(results[1]));
+}
+
+TEST(ContainerRequestIntegrationTest, StartAllThrowsOnFailure) {
+  std::vector<ContainerRequest> requests;
+  requests.push_back(GenericImage("alpine", "latest").with_cmd({"sh", "-c", "sleep 200"}));
+  requests.push_back(
+      GenericImage("testcontainers-cxx-nonexistent-image", "latest").with_cmd({"true"}));
+
+  EXPECT_THROW(ContainerRequest::start_all(std::move(requests)), Error);
+}
+
+TEST(ContainerRequestIntegrationTest, StartAllFromClonedTemplate) {
+  auto base = GenericImage("alpine", "latest")
+                  .with_env_var("TEMPLATE", "shared")
+                  .with_cmd({"sh", "-c", "echo template=$TEMPLATE && sleep 200"})
+                  .with_ready_conditions({WaitFor::message_on_stdout("template=")});
+
+  std::vector<ContainerRequest> requests;
+  for (int i = 0; i < 3; ++i) {
+    requests.push_back(base.clone());
+  }
+
+  auto containers = ContainerRequest::start_all(std::move(requests));
+
+  ASSERT_EQ(containers.size(), 3);
+  for (const auto &container : containers) {
+    EXPECT_THAT(container.stdout_to_string(), HasSubstr("template=shared"));
+  }
+  EXPECT_TRUE(base.start().is_running());
+}
+
 // ============================================================================
 // Complex Configuration Chains
 // ============================================================================
@@ -435,3 +623,61 @@ TEST(ContainerRequestIntegrationTest, VerifyUser) {
 
   EXPECT_THAT(container.stdout_to_string(), HasSubstr("nobody"));
 }
+
+// ============================================================================
+// Container Spec
+// ============================================================================
+
+TEST(ContainerRequestIntegrationTest, StartFromSpec) {
+  const ContainerSpec spec{
+      .name = "alpine",
+      .cmd = {"sh", "-c", "echo \"$SPEC_VAR\" && pwd && sleep 200"},
+      .env_vars = {{"SPEC_VAR", "from-spec"}},
+      .mounts = {{ContainerSpec::Mount::Type::Tmpfs, "", "/scratch"}},
+      .working_dir = "/usr/local",
+  };
+
+  auto container = ContainerRequest::from_spec(spec)
+                       .with_ready_conditions({WaitFor::message_on_stdout("/usr/local")})
+                       .start();
+
+  auto stdout_str = container.stdout_to_string();
+  EXPECT_THAT(stdout_str, HasSubstr("from-spec"));
+  EXPECT_THAT(stdout_str, HasSubstr("/usr/local"));
+
+  auto result = container.exec(ExecCommand({"sh", "-c", "mount | grep /scratch"}));
+  EXPECT_THAT(result.stdout_to_string(), HasSubstr("tmpfs"));
+}
+
+// ============================================================================
+// Container Reuse
+// ============================================================================
+
+TEST(ContainerRequestIntegrationTest, ReuseKeyAttachesToRunningContainer) {
+  auto request = [] {
+    return GenericImage("alpine", "latest")
+        .with_cmd({"sh", "-c", "sleep 200"})
+        .with_reuse_key("reuse-key-attach-test");
+  };
+
+  auto first = request().start();
+  auto second = request().start();
+  EXPECT_EQ(first.id(), second.id());
+
+  Container::rm(std::move(first));
+}
+
+TEST(ContainerRequestIntegrationTest, DifferentReuseKeysStartSeparateContainers) {
+  auto first = GenericImage("alpine", "latest")
+                   .with_cmd({"sh", "-c", "sleep 200"})
+                   .with_reuse_key("reuse-key-first")
+                   .start();
+  auto second = GenericImage("alpine", "latest")
+                    .with_cmd({"sh", "-c", "sleep 200"})
+                    .with_reuse_key("reuse-key-second")
+                    .start();
+  EXPECT_NE(first.id(), second.id());
+
+  Container::rm(std::move(first));
+  Container::rm(std::move(second));
+}
@@ -270,6 +270,140 @@ TEST(GenericImageIntegrationTest, StartWithMultipleWaitConditions) {
   EXPECT_TRUE(container.is_running());
 }
 
+TEST(GenericImageIntegrationTest, StartWithListeningPortWait) {
+  auto container = GenericImage("redis", "7")
+                       .with_exposed_port(ContainerPort::Tcp(6379))
+                       .with_wait_for(WaitFor::listening_port(ContainerPort::Tcp(6379),
+                                                              std::chrono::seconds(30)))
+                       .start();
+
+  EXPECT_TRUE(container.is_running());
+  auto result = container.exec(ExecCommand({"redis-cli", "PING"}));
+  EXPECT_THAT(result.stdout_to_string(), HasSubstr("PONG"));
+}
+
+TEST(GenericImageIntegrationTest, ListeningPortWaitIgnoresHostSideProxy) {
+  // The port is published but nothing listens on it, a userland proxy may still accept
+  auto request = GenericImage("alpine", "latest")
+                     .with_exposed_port(ContainerPort::Tcp(8080))
+                     .with_wait_for(WaitFor::listening_port(ContainerPort::Tcp(8080),
+                                                            std::chrono::seconds(2)))
+                     .with_cmd({"sh", "-c", "sleep 200"});
+
+  try {
+    request.start();
+    FAIL() << "Expected the start to fail";
+  } catch (const Error &e) {
+    EXPECT_THAT(e.what(), HasSubstr("not listening"));
+  }
+}
+
+TEST(GenericImageIntegrationTest, StartWithListeningPortAndLogConditions) {
+  std::vector<WaitFor> conditions = {
+      WaitFor::message_on_stdout("Ready to accept connections"),
+      WaitFor::listening_port(ContainerPort::Tcp(6379), std::chrono::seconds(30)),
+  };
+
+  auto container = GenericImage("redis", "7")
+                       .with_exposed_port(ContainerPort::Tcp(6379))
+                       .with_ready_conditions(conditions)
+                       .start();
+
+  EXPECT_TRUE(container.is_running());
+}
+
+TEST(GenericImageIntegrationTest, StartWithHttpWait) {
+  auto container =
+      GenericImage("nginx", "alpine")
+          .with_exposed_port(ContainerPort::Tcp(80))
+          .with_wait_for(WaitFor::http(HttpWaitStrategy::path("/")
+                                           .with_port(ContainerPort::Tcp(80))
+                                           .with_expected_status_code(200)
+                                           .with_body_matcher([](std::string_view body) {
+                                             return body.find("Welcome to nginx") !=
+                                                    std::string_view::npos;
+                                           })
+                                           .with_poll_interval(std::chrono::milliseconds(50))))
+          .start();
+
+  EXPECT_TRUE(container.is_running());
+}
+
+TEST(GenericImageIntegrationTest, StartWithHttpWaitTimesOut) {
+  auto request = GenericImage("nginx", "alpine")
+                     .with_exposed_port(ContainerPort::Tcp(80))
+                     .with_wait_for(WaitFor::http(
+                         HttpWaitStrategy::path("/").with_expected_status_code(418)))
+                     .with_startup_timeout(std::chrono::seconds(3));
+
+  EXPECT_THROW(request.start(), Error);
+}
+
+TEST(GenericImageIntegrationTest, StartWithAllOfWait) {
+  auto container =
+      GenericImage("redis", "7")
+          .with_exposed_port(ContainerPort::Tcp(6379))
+          .with_wait_for(WaitFor::all_of(
+              {WaitFor::message_on_stdout("Ready to accept connections"),
+               WaitFor::listening_port(ContainerPort::Tcp(6379), std::chrono::seconds(30))}))
+          .start();
+
+  EXPECT_TRUE(container.is_running());
+}
+
+TEST(GenericImageIntegrationTest, StartWithAnyOfWait) {
+  auto container = GenericImage("alpine", "latest")
+                       .with_wait_for(WaitFor::any_of({WaitFor::message_on_stdout("never printed"),
+                                                       WaitFor::message_on_stderr("ready")}))
+                       .with_cmd({"sh", "-c", "echo ready >&2 && sleep 100"})
+                       .with_startup_timeout(std::chrono::seconds(30))
+                       .start();
+
+  EXPECT_TRUE(container.is_running());
+}
+
+TEST(GenericImageIntegrationTest, StartWithRegexLogWait) {
+  auto container =
+      GenericImage("alpine", "latest")
+          .with_wait_for(WaitFor::Log(
+              LogWaitStrategy::std_out_regex(R"(^\[pid \d+\] listening on port \d+$)")))
+          .with_cmd({"sh", "-c", "sleep 1 && echo \"[pid $$] listening on port 8080\"; sleep 100"})
+          .with_startup_timeout(std::chrono::seconds(30))
+          .start();
+
+  EXPECT_TRUE(container.is_running());
+  EXPECT_THAT(container.stdout_to_string(), HasSubstr("listening on port 8080"));
+}
+
+TEST(GenericImageIntegrationTest, StartWithRegexAnyOfLogWaitOnStderr) {
+  auto container = GenericImage("alpine", "latest")
+                       .with_wait_for(WaitFor::Log(LogWaitStrategy::std_err_regex_any_of(
+                                                       {"never printed", R"(ready after \d+s)"})
+                                                       .with_times(2)))
+                       .with_cmd({"sh", "-c",
+                                  "echo 'ready after 1s' >&2 && echo 'ready after 2s' >&2 && "
+                                  "sleep 100"})
+                       .with_startup_timeout(std::chrono::seconds(30))
+                       .start();
+
+  EXPECT_TRUE(container.is_running());
+}
+
+TEST(GenericImageIntegrationTest, StartWithAllOfWaitTimesOut) {
+  auto request = GenericImage("alpine", "latest")
+                     .with_wait_for(WaitFor::all_of({WaitFor::message_on_stdout("first"),
+                                                     WaitFor::message_on_stdout("never printed")}))
+                     .with_cmd({"sh", "-c", "echo first && sleep 100"})
+                     .with_startup_timeout(std::chrono::seconds(3));
+
+  try {
+    request.start();
+    FAIL() << "Expected the start to time out";
+  } catch (const Error &e) {
+    EXPECT_THAT(e.what(), HasSubstr("not ready"));
+  }
+}
+
 // ============================================================================
 // Network Configuration
 // ============================================================================
@@ -427,3 +561,24 @@ TEST(GenericImageIntegrationTest, PullImage) {
 
   EXPECT_TRUE(container.is_running());
 }
+
+// ============================================================================
+// Batch Start
+// ============================================================================
+
+TEST(GenericImageIntegrationTest, StartAll) {
+  std::vector<GenericImage> images;
+  for (int i = 0; i < 2; ++i) {
+    images.push_back(GenericImage("redis", "7.2")
+                         .with_exposed_port(ContainerPort::Tcp(6379))
+                         .with_wait_for(WaitFor::message_on_stdout("Ready to accept connections")));
+  }
+
+  auto containers = GenericImage::start_all(std::move(images));
+
+  ASSERT_EQ(containers.size(), 2);
+  EXPECT_TRUE(containers[0].is_running());
+  EXPECT_TRUE(containers[1].is_running());
+  EXPECT_NE(containers[0].get_host_port_ipv4(ContainerPort::Tcp(6379)),
+            containers[1].get_host_port_ipv4(ContainerPort::Tcp(6379)));
+}
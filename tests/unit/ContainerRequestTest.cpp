@@ -1,4 +1,5 @@
 #include <chrono>
+#include <fstream>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -405,6 +406,52 @@ TEST(ContainerRequestTest, WithWorkingDirNested) {
   EXPECT_TRUE(result.is_valid());
 }
 
+// ====================
+// with_log_consumer Tests
+// ====================
+
+TEST(ContainerRequestTest, WithLogConsumer) {
+  auto result = create_request().with_log_consumer([](std::span<const LogFrame>) {});
+  EXPECT_TRUE(result.is_valid());
+}
+
+TEST(ContainerRequestTest, WithLogConsumerFromImage) {
+  auto result
+      = GenericImage("alpine", "latest").with_log_consumer([](std::span<const LogFrame>) {});
+  EXPECT_TRUE(result.is_valid());
+}
+
+// ====================
+// with_reuse Tests
+// ====================
+
+TEST(ContainerRequestTest, WithReuseAlways) {
+  auto result = create_request().with_reuse(ReuseDirective::Always());
+  EXPECT_TRUE(result.is_valid());
+}
+
+TEST(ContainerRequestTest, WithReuseCurrentSession) {
+  auto result = create_request().with_reuse(ReuseDirective::CurrentSession());
+  EXPECT_TRUE(result.is_valid());
+}
+
+TEST(ContainerRequestTest, WithReuseKey) {
+  auto result = create_request().with_reuse_key("postgres-shared");
+  EXPECT_TRUE(result.is_valid());
+}
+
+TEST(ContainerRequestTest, WithReuseKeyDerivedFromSpec) {
+  auto first = create_request().with_reuse_key();
+  auto second = create_request().with_reuse_key();
+  EXPECT_EQ(first.spec_key(), second.spec_key());
+}
+
+TEST(ContainerRequestTest, WithReuseKeyDistinguishesKeys) {
+  auto first = create_request().with_reuse_key("first");
+  auto second = create_request().with_reuse_key("second");
+  EXPECT_NE(first.spec_key(), second.spec_key());
+}
+
 // ====================
 // with_user Tests
 // ====================
@@ -507,6 +554,14 @@ TEST(ContainerRequestTest, WithCopyToData) {
   EXPECT_TRUE(result.is_valid());
 }
 
+TEST(ContainerRequestTest, WithCopyToRejectsMappedFile) {
+  TempFile source("config content");
+  auto request = create_request();
+  EXPECT_THROW(request.with_copy_to("/app/config.txt", CopyDataSource::MappedFile(source.path())),
+               Error);
+  EXPECT_TRUE(request.is_valid());
+}
+
 TEST(ContainerRequestTest, WithMultipleCopyTo) {
   TempFile file1("config1");
   TempFile file2("config2");
@@ -699,3 +754,97 @@ TEST(ContainerRequestTest, ManyMounts) {
   EXPECT_TRUE(request.is_valid());
 }
 
+// ====================
+// start_all Tests
+// ====================
+
+TEST(ContainerRequestTest, StartAllEmpty) {
+  auto containers = ContainerRequest::start_all({});
+  EXPECT_TRUE(containers.empty());
+}
+
+TEST(ContainerRequestTest, TryStartAllEmpty) {
+  auto results = ContainerRequest::try_start_all({});
+  EXPECT_TRUE(results.empty());
+}
+
+// ====================
+// clone Tests
+// ====================
+
+TEST(ContainerRequestTest, CloneKeepsConfiguration) {
+  auto request = create_request().with_env_var("KEY", "value");
+  auto copy = request.clone();
+  EXPECT_TRUE(request.is_valid());
+  EXPECT_TRUE(copy.is_valid());
+  EXPECT_EQ(request.spec_key(), copy.spec_key());
+}
+
+TEST(ContainerRequestTest, CloneIsIndependent) {
+  auto request = create_request();
+  auto copy = request.clone().with_env_var("KEY", "value");
+  EXPECT_NE(request.spec_key(), copy.spec_key());
+}
+
+TEST(ContainerRequestTest, CloneManyForStartAll) {
+  auto request = create_request();
+  std::vector<ContainerRequest> requests;
+  for (int i = 0; i < 8; ++i) {
+    requests.push_back(request.clone());
+  }
+  EXPECT_EQ(requests.size(), 8u);
+  EXPECT_TRUE(request.is_valid());
+}
+
+// ====================
+// spec_key Tests
+// ====================
+
+TEST(ContainerRequestTest, SpecKeyEqualForSameSpec) {
+  EXPECT_EQ(create_request().spec_key(), create_request().spec_key());
+}
+
+TEST(ContainerRequestTest, SpecKeyIgnoresOptionOrder) {
+  auto first = create_request().with_env_var("A", "1").with_env_var("B", "2");
+  auto second = create_request().with_env_var("B", "2").with_env_var("A", "1");
+  EXPECT_EQ(first.spec_key(), second.spec_key());
+}
+
+TEST(ContainerRequestTest, SpecKeyDiffersForDifferentSpec) {
+  auto other = GenericImage("alpine", "latest").with_cmd({"echo", "other"});
+  EXPECT_NE(create_request().spec_key(), other.spec_key());
+}
+
+TEST(ContainerRequestTest, SpecKeyIgnoresMountOrder) {
+  auto first = create_request()
+                   .with_mount(Mount::TmpfsMount("/tmp/a"))
+                   .with_mount(Mount::TmpfsMount("/tmp/b"));
+  auto second = create_request()
+                    .with_mount(Mount::TmpfsMount("/tmp/b"))
+                    .with_mount(Mount::TmpfsMount("/tmp/a"));
+  EXPECT_EQ(first.spec_key(), second.spec_key());
+}
+
+TEST(ContainerRequestTest, SpecKeyFollowsCopiedData) {
+  std::vector<std::uint8_t> data(1 << 20, 0x2a);
+  auto first = create_request().with_copy_to("/app/data.bin", CopyDataSource::Data(data));
+  auto same = create_request().with_copy_to("/app/data.bin", CopyDataSource::Data(data));
+  data.back() = 0;
+  auto changed = create_request().with_copy_to("/app/data.bin", CopyDataSource::Data(data));
+
+  EXPECT_EQ(first.spec_key(), same.spec_key());
+  EXPECT_NE(first.spec_key(), changed.spec_key());
+  // The key is a digest, not the copied content
+  EXPECT_EQ(first.spec_key().size(), create_request().spec_key().size());
+}
+
+TEST(ContainerRequestTest, SpecKeyFollowsCopiedFileContent) {
+  TempFile file("config");
+  auto first = create_request().with_copy_to("/app/config", CopyDataSource::File(file.path()));
+  auto same = create_request().with_copy_to("/app/config", CopyDataSource::File(file.path()));
+  std::ofstream(file.path()) << "changed config";
+  auto changed = create_request().with_copy_to("/app/config", CopyDataSource::File(file.path()));
+
+  EXPECT_EQ(first.spec_key(), same.spec_key());
+  EXPECT_NE(first.spec_key(), changed.spec_key());
+}
@@ -0,0 +1,218 @@
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include <testcontainers/testcontainers.hpp>
+
+using namespace testcontainers;
+
+static ContainerSpec create_spec() {
+  return ContainerSpec{
+      .name = "alpine",
+      .tag = "latest",
+      .cmd = {"sleep", "200"},
+      .exposed_ports = {{8080}, {5353, ContainerSpec::Protocol::Udp}},
+      .mapped_ports = {{18080, {8080}}},
+      .env_vars = {{"KEY", "value"}},
+      .labels = {{"team", "platform"}},
+      .mounts = {{ContainerSpec::Mount::Type::Tmpfs, "", "/scratch"},
+                 {ContainerSpec::Mount::Type::Volume, "data", "/data", true}},
+      .working_dir = "/tmp",
+      .shm_size = 64 * 1024 * 1024,
+      .startup_timeout = std::chrono::seconds(30),
+      .cap_add = {"NET_ADMIN"},
+  };
+}
+
+// The builder chain create_spec() stands for
+static ContainerRequest create_request() {
+  return GenericImage("alpine", "latest")
+      .with_exposed_port(ContainerPort::Tcp(8080))
+      .with_exposed_port(ContainerPort::Udp(5353))
+      .with_cmd({"sleep", "200"})
+      .with_mapped_port(18080, ContainerPort::Tcp(8080))
+      .with_env_var("KEY", "value")
+      .with_label("team", "platform")
+      .with_mount(Mount::TmpfsMount("/scratch"))
+      .with_mount(Mount::VolumeMount("data", "/data").with_read_only())
+      .with_working_dir("/tmp")
+      .with_shm_size(64 * 1024 * 1024)
+      .with_startup_timeout(std::chrono::seconds(30))
+      .with_cap_add("NET_ADMIN");
+}
+
+// ====================
+// validate Tests
+// ====================
+
+TEST(ContainerSpecTest, ValidateFullSpec) { EXPECT_NO_THROW(create_spec().validate()); }
+
+TEST(ContainerSpecTest, ValidateEmptyName) {
+  auto spec = create_spec();
+  spec.name.clear();
+  EXPECT_THROW(spec.validate(), Error);
+}
+
+TEST(ContainerSpecTest, ValidateZeroPort) {
+  auto spec = create_spec();
+  spec.exposed_ports.push_back({0});
+  EXPECT_THROW(spec.validate(), Error);
+}
+
+TEST(ContainerSpecTest, ValidateEnvVarNameWithEquals) {
+  auto spec = create_spec();
+  spec.env_vars.emplace_back("A=B", "value");
+  EXPECT_THROW(spec.validate(), Error);
+}
+
+TEST(ContainerSpecTest, ValidateRelativeMountTarget) {
+  auto spec = create_spec();
+  spec.mounts.push_back({ContainerSpec::Mount::Type::Bind, "/host", "relative"});
+  EXPECT_THROW(spec.validate(), Error);
+}
+
+TEST(ContainerSpecTest, ValidateBindMountWithoutSource) {
+  auto spec = create_spec();
+  spec.mounts.push_back({ContainerSpec::Mount::Type::Bind, "", "/mnt"});
+  EXPECT_THROW(spec.validate(), Error);
+}
+
+// ====================
+// ContainerRequest::from_spec Tests
+// ====================
+
+TEST(ContainerSpecTest, FromSpecMinimal) {
+  auto request = ContainerRequest::from_spec(ContainerSpec{.name = "alpine"});
+  EXPECT_TRUE(request.is_valid());
+  EXPECT_EQ(request.spec_key(), GenericImage("alpine", "latest").with_tag("latest").spec_key());
+}
+
+TEST(ContainerSpecTest, FromSpecFull) {
+  auto request = ContainerRequest::from_spec(create_spec());
+  EXPECT_TRUE(request.is_valid());
+  EXPECT_EQ(request.spec_key(), create_request().spec_key());
+}
+
+TEST(ContainerSpecTest, FromSpecImage) {
+  auto request = ContainerRequest::from_spec(ContainerSpec{
+      .name = "alpine",
+      .tag = "3.20",
+      .entrypoint = "/bin/sh",
+      .cmd = {"-c", "sleep 200"},
+  });
+  auto expected =
+      GenericImage("alpine", "3.20").with_entrypoint("/bin/sh").with_cmd({"-c", "sleep 200"});
+  EXPECT_EQ(request.spec_key(), expected.spec_key());
+}
+
+TEST(ContainerSpecTest, FromSpecPorts) {
+  auto request = ContainerRequest::from_spec(ContainerSpec{
+      .name = "alpine",
+      .exposed_ports = {{8080}, {5353, ContainerSpec::Protocol::Udp},
+                        {9000, ContainerSpec::Protocol::Sctp}},
+      .mapped_ports = {{18080, {8080}}, {15353, {5353, ContainerSpec::Protocol::Udp}}},
+  });
+  auto expected = GenericImage("alpine", "latest")
+                      .with_exposed_port(ContainerPort::Tcp(8080))
+                      .with_exposed_port(ContainerPort::Udp(5353))
+                      .with_exposed_port(ContainerPort::Sctp(9000))
+                      .with_mapped_port(18080, ContainerPort::Tcp(8080))
+                      .with_mapped_port(15353, ContainerPort::Udp(5353));
+  EXPECT_EQ(request.spec_key(), expected.spec_key());
+}
+
+TEST(ContainerSpecTest, FromSpecEnvVarsAndLabels) {
+  auto request = ContainerRequest::from_spec(ContainerSpec{
+      .name = "alpine",
+      .env_vars = {{"A", "1"}, {"B", "2"}},
+      .labels = {{"team", "platform"}, {"tier", "db"}},
+  });
+  auto expected = GenericImage("alpine", "latest")
+                      .with_env_var("A", "1")
+                      .with_env_var("B", "2")
+                      .with_label("team", "platform")
+                      .with_label("tier", "db");
+  EXPECT_EQ(request.spec_key(), expected.spec_key());
+}
+
+TEST(ContainerSpecTest, FromSpecMounts) {
+  auto request = ContainerRequest::from_spec(ContainerSpec{
+      .name = "alpine",
+      .mounts = {{ContainerSpec::Mount::Type::Bind, "/host", "/mnt", true},
+                 {ContainerSpec::Mount::Type::Volume, "data", "/data"},
+                 {ContainerSpec::Mount::Type::Tmpfs, "", "/scratch"}},
+  });
+  auto expected = GenericImage("alpine", "latest")
+                      .with_mount(Mount::BindMount("/host", "/mnt").with_read_only())
+                      .with_mount(Mount::VolumeMount("data", "/data"))
+                      .with_mount(Mount::TmpfsMount("/scratch"));
+  EXPECT_EQ(request.spec_key(), expected.spec_key());
+}
+
+TEST(ContainerSpecTest, FromSpecIdentity) {
+  auto request = ContainerRequest::from_spec(ContainerSpec{
+      .name = "alpine",
+      .container_name = "spec-test",
+      .hostname = "spec-host",
+      .network = "spec-net",
+      .platform = "linux/amd64",
+      .working_dir = "/srv",
+      .user = "nobody",
+      .userns_mode = "host",
+  });
+  auto expected = GenericImage("alpine", "latest")
+                      .with_container_name("spec-test")
+                      .with_hostname("spec-host")
+                      .with_network("spec-net")
+                      .with_platform("linux/amd64")
+                      .with_working_dir("/srv")
+                      .with_user("nobody")
+                      .with_userns_mode("host");
+  EXPECT_EQ(request.spec_key(), expected.spec_key());
+}
+
+TEST(ContainerSpecTest, FromSpecSecurity) {
+  auto request = ContainerRequest::from_spec(ContainerSpec{
+      .name = "alpine",
+      .privileged = true,
+      .readonly_rootfs = true,
+      .cap_add = {"NET_ADMIN"},
+      .cap_drop = {"MKNOD"},
+      .security_opts = {"no-new-privileges"},
+  });
+  auto expected = GenericImage("alpine", "latest")
+                      .with_privileged(true)
+                      .with_readonly_rootfs(true)
+                      .with_cap_add("NET_ADMIN")
+                      .with_cap_drop("MKNOD")
+                      .with_security_opt("no-new-privileges");
+  EXPECT_EQ(request.spec_key(), expected.spec_key());
+}
+
+TEST(ContainerSpecTest, FromSpecResources) {
+  auto request = ContainerRequest::from_spec(ContainerSpec{
+      .name = "alpine",
+      .shm_size = 64 * 1024 * 1024,
+      .startup_timeout = std::chrono::seconds(30),
+  });
+  auto expected = GenericImage("alpine", "latest")
+                      .with_shm_size(64 * 1024 * 1024)
+                      .with_startup_timeout(std::chrono::seconds(30));
+  EXPECT_EQ(request.spec_key(), expected.spec_key());
+}
+
+TEST(ContainerSpecTest, FromSpecReusesConstSpec) {
+  const auto spec = create_spec();
+  auto first = ContainerRequest::from_spec(spec);
+  auto second = ContainerRequest::from_spec(spec);
+  EXPECT_EQ(first.spec_key(), second.spec_key());
+}
+
+TEST(ContainerSpecTest, FromSpecChainsBuilderMethods) {
+  auto request = ContainerRequest::from_spec(create_spec()).with_reuse_key("spec");
+  EXPECT_TRUE(request.is_valid());
+}
+
+TEST(ContainerSpecTest, FromSpecInvalidThrows) {
+  EXPECT_THROW(ContainerRequest::from_spec(ContainerSpec{}), Error);
+}
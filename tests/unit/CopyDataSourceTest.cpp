@@ -1,4 +1,6 @@
 #include <filesystem>
+#include <span>
+#include <string_view>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -41,6 +43,22 @@ TEST(CopyDataSourceTest, FileRelativePath) {
   EXPECT_TRUE(source.is_valid());
 }
 
+// ====================
+// CopyDataSource::MappedFile Tests
+// ====================
+
+TEST(CopyDataSourceTest, MappedFileFromTempFile) {
+  TempFile temp("test content");
+  auto source = CopyDataSource::MappedFile(temp.path());
+  EXPECT_TRUE(source.is_valid());
+}
+
+TEST(CopyDataSourceTest, MappedFileNonExistentPath) {
+  // Mapping is deferred until the copy happens
+  auto source = CopyDataSource::MappedFile("/nonexistent/path/file.txt");
+  EXPECT_TRUE(source.is_valid());
+}
+
 // ====================
 // CopyDataSource::Data Tests
 // ====================
@@ -75,6 +93,22 @@ TEST(CopyDataSourceTest, DataWithNullBytes) {
   EXPECT_TRUE(source.is_valid());
 }
 
+TEST(CopyDataSourceTest, DataFromSpan) {
+  const std::uint8_t data[] = {0x48, 0x65, 0x6C, 0x6C, 0x6F};
+  auto source = CopyDataSource::Data(std::span<const std::uint8_t>(data));
+  EXPECT_TRUE(source.is_valid());
+}
+
+TEST(CopyDataSourceTest, DataFromStringView) {
+  auto source = CopyDataSource::Data(std::string_view("Hello"));
+  EXPECT_TRUE(source.is_valid());
+}
+
+TEST(CopyDataSourceTest, DataFromEmptyStringView) {
+  auto source = CopyDataSource::Data(std::string_view());
+  EXPECT_TRUE(source.is_valid());
+}
+
 // ====================
 // CopyDataSource Move Semantics Tests
 // ====================
@@ -166,6 +166,20 @@ TEST(GenericBuildableImageTest, WithDataEmptyTarget) {
   EXPECT_TRUE(result.is_valid());
 }
 
+TEST(GenericBuildableImageTest, WithDataFromSpan) {
+  const std::uint8_t data[] = {0x48, 0x65, 0x6C, 0x6C, 0x6F};
+
+  GenericBuildableImage image("myapp", "latest");
+  auto result = image.with_data(std::span<const std::uint8_t>(data), "/app/data.bin");
+  EXPECT_TRUE(result.is_valid());
+}
+
+TEST(GenericBuildableImageTest, WithDataFromStringView) {
+  GenericBuildableImage image("myapp", "latest");
+  auto result = image.with_data(std::string_view("key=value\n"), "/app/config.env");
+  EXPECT_TRUE(result.is_valid());
+}
+
 // ====================
 // Complex Fluent Chain Tests
 // ====================
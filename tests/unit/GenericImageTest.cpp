@@ -127,6 +127,14 @@ TEST(GenericImageTest, WithWaitForExit) {
   EXPECT_TRUE(result.is_valid());
 }
 
+TEST(GenericImageTest, WithWaitForListeningPort) {
+  auto result = GenericImage("redis", "latest")
+                    .with_wait_for(WaitFor::listening_port(ContainerPort::Tcp(6379),
+                                                           std::chrono::seconds(30)));
+  EXPECT_TRUE(result.is_valid());
+  EXPECT_EQ(result.ready_conditions().size(), 1);
+}
+
 TEST(GenericImageTest, WithWaitForMessageOnStdout) {
   auto result = GenericImage("redis", "latest").with_wait_for(WaitFor::message_on_stdout("Ready"));
   EXPECT_TRUE(result.is_valid());
@@ -345,6 +353,22 @@ TEST(GenericImageTest, WithWorkingDir) {
   EXPECT_TRUE(result.is_valid());
 }
 
+TEST(GenericImageTest, WithReuse) {
+  auto result = GenericImage("postgres", "latest").with_reuse(ReuseDirective::Always());
+  EXPECT_TRUE(result.is_valid());
+}
+
+TEST(GenericImageTest, WithReuseKey) {
+  auto result = GenericImage("postgres", "latest").with_reuse_key("postgres-shared");
+  EXPECT_TRUE(result.is_valid());
+}
+
+TEST(GenericImageTest, WithReuseKeyMatchesRequestLevelKey) {
+  auto from_image = GenericImage("postgres", "latest").with_reuse_key();
+  auto request = GenericImage("postgres", "latest").with_reuse(ReuseDirective::Never());
+  EXPECT_EQ(from_image.spec_key(), request.with_reuse_key().spec_key());
+}
+
 TEST(GenericImageTest, WithUser) {
   auto result = GenericImage("postgres", "latest").with_user("postgres");
   EXPECT_TRUE(result.is_valid());
@@ -493,6 +517,27 @@ TEST(GenericImageTest, MoveAssignment) {
   EXPECT_TRUE(image2.is_valid());
 }
 
+// ====================
+// clone Tests
+// ====================
+
+TEST(GenericImageTest, CloneKeepsConfiguration) {
+  auto image = GenericImage("redis", "7.2.4").with_exposed_port(ContainerPort::Tcp(6379));
+  auto copy = image.clone();
+  EXPECT_TRUE(image.is_valid());
+  EXPECT_TRUE(copy.is_valid());
+  EXPECT_EQ(copy.name(), "redis");
+  EXPECT_EQ(copy.tag(), "7.2.4");
+  EXPECT_EQ(copy.expose_ports().size(), 1u);
+}
+
+TEST(GenericImageTest, CloneIsIndependent) {
+  GenericImage image("redis", "latest");
+  auto copy = image.clone().with_entrypoint("/bin/sh");
+  EXPECT_FALSE(image.entrypoint().has_value());
+  EXPECT_TRUE(copy.entrypoint().has_value());
+}
+
 // ====================
 // Edge Cases Tests
 // ====================
@@ -528,3 +573,8 @@ TEST(GenericImageTest, EmptyStringsInVariousMethods) {
                     .with_user("");
   EXPECT_TRUE(result.is_valid());
 }
+
+TEST(GenericImageTest, StartAllEmpty) {
+  auto containers = GenericImage::start_all({});
+  EXPECT_TRUE(containers.empty());
+}
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <testcontainers/core/ReuseDirective.hpp>
+
+using namespace testcontainers;
+
+// ====================
+// ReuseDirective Factory Tests
+// ====================
+
+TEST(ReuseDirectiveTest, NeverBasic) {
+  auto directive = ReuseDirective::Never();
+  EXPECT_TRUE(directive.is_valid());
+}
+
+TEST(ReuseDirectiveTest, AlwaysBasic) {
+  auto directive = ReuseDirective::Always();
+  EXPECT_TRUE(directive.is_valid());
+}
+
+TEST(ReuseDirectiveTest, CurrentSessionBasic) {
+  auto directive = ReuseDirective::CurrentSession();
+  EXPECT_TRUE(directive.is_valid());
+}
+
+// ====================
+// ReuseDirective Move Semantics Tests
+// ====================
+
+TEST(ReuseDirectiveTest, MoveConstructor) {
+  auto directive1 = ReuseDirective::Always();
+  auto directive2 = std::move(directive1);
+  EXPECT_TRUE(directive2.is_valid());
+}
+
+TEST(ReuseDirectiveTest, MoveAssignment) {
+  auto directive1 = ReuseDirective::Always();
+  auto directive2 = ReuseDirective::Never();
+  directive2 = std::move(directive1);
+  EXPECT_TRUE(directive2.is_valid());
+}
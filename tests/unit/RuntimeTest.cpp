@@ -0,0 +1,28 @@
+#include <gtest/gtest.h>
+
+#include <testcontainers/Container.hpp>
+#include <testcontainers/ContainerRequest.hpp>
+#include <testcontainers/Error.hpp>
+#include <testcontainers/Runtime.hpp>
+
+using namespace testcontainers;
+
+// Built as its own executable, nothing in this process starts the shared runtime.
+
+TEST(RuntimeTest, ConfigureZeroWorkerThreadsThrows) {
+  EXPECT_THROW(Runtime::configure(0), Error);
+}
+
+TEST(RuntimeTest, ConfigureWorkerThreads) {
+  EXPECT_NO_THROW(Runtime::configure(2));
+}
+
+TEST(RuntimeTest, ConfigureTwiceBeforeStart) {
+  EXPECT_NO_THROW(Runtime::configure(4));
+  EXPECT_NO_THROW(Runtime::configure(2));
+}
+
+TEST(RuntimeTest, StartAllEmptyDoesNotStartRuntime) {
+  EXPECT_TRUE(ContainerRequest::start_all({}).empty());
+  EXPECT_NO_THROW(Runtime::configure(2));
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <testcontainers/Error.hpp>
 #include <testcontainers/core/wait/WaitFor.hpp>
 
 using namespace testcontainers;
@@ -48,8 +49,107 @@ TEST(WaitForTest, LogWaitStrategyWithTimes) {
   EXPECT_TRUE(wait.is_valid());
 }
 
+TEST(WaitForTest, LogRegex) {
+  auto wait = WaitFor::Log(LogWaitStrategy::std_out_regex(R"(started in \d+ms)").with_times(2));
+  EXPECT_TRUE(wait.is_valid());
+}
+
+TEST(WaitForTest, LogRegexAnyOf) {
+  auto wait =
+      WaitFor::Log(LogWaitStrategy::stdout_or_stderr_regex_any_of({"^ready$", "^listening"}));
+  EXPECT_TRUE(wait.is_valid());
+}
+
+TEST(WaitForTest, LogRegexInvalidThrows) {
+  EXPECT_THROW(LogWaitStrategy::std_err_regex("(unclosed"), Error);
+}
+
+TEST(WaitForTest, LogRegexAnyOfEmptyThrows) {
+  EXPECT_THROW(LogWaitStrategy::std_out_regex_any_of({}), Error);
+}
+
 TEST(WaitForTest, HealthWaitStrategyWithPollInterval) {
   auto wait = WaitFor::Healthcheck(
       HealthWaitStrategy::healthcheck().with_poll_interval(std::chrono::seconds(1)));
   EXPECT_TRUE(wait.is_valid());
 }
+
+TEST(WaitForTest, HealthWaitStrategyWithPollBackoff) {
+  auto wait = WaitFor::Healthcheck(
+      HealthWaitStrategy::healthcheck()
+          .with_poll_backoff(std::chrono::milliseconds(5), 2.0, std::chrono::seconds(1))
+          .with_poll_jitter(0.1));
+  EXPECT_TRUE(wait.is_valid());
+}
+
+TEST(WaitForTest, ExitWaitStrategyWithPollBackoff) {
+  auto wait = WaitFor::Exit(ExitWaitStrategy::exit().with_poll_backoff(
+      std::chrono::milliseconds(10), 1.5, std::chrono::milliseconds(500)));
+  EXPECT_TRUE(wait.is_valid());
+}
+
+TEST(WaitForTest, ListeningPort) {
+  auto wait = WaitFor::listening_port(ContainerPort::Tcp(8080), std::chrono::seconds(30));
+  EXPECT_TRUE(wait.is_valid());
+}
+
+TEST(WaitForTest, CopyListeningPort) {
+  auto wait = WaitFor::listening_port(ContainerPort::Tcp(8080), std::chrono::seconds(30));
+  WaitFor copy(wait);
+  EXPECT_TRUE(wait.is_valid());
+  EXPECT_TRUE(copy.is_valid());
+}
+
+TEST(WaitForTest, HttpWaitStrategyWithPath) {
+  auto wait = WaitFor::http(HttpWaitStrategy::path("/healthz"));
+  EXPECT_TRUE(wait.is_valid());
+}
+
+TEST(WaitForTest, HttpWaitStrategyWithAllOptions) {
+  auto wait = WaitFor::Http(HttpWaitStrategy::path("/healthz")
+                                .with_port(ContainerPort::Tcp(8080))
+                                .with_expected_status_code(204)
+                                .with_body_matcher([](std::string_view body) {
+                                  return body.find("ok") != std::string_view::npos;
+                                })
+                                .with_poll_interval(std::chrono::milliseconds(50)));
+  EXPECT_TRUE(wait.is_valid());
+
+  WaitFor copy(wait);
+  EXPECT_TRUE(copy.is_valid());
+}
+
+TEST(WaitForTest, AllOf) {
+  auto wait = WaitFor::all_of({WaitFor::message_on_stdout("Ready"), WaitFor::healthcheck(),
+                               WaitFor::listening_port(ContainerPort::Tcp(8080),
+                                                       std::chrono::seconds(30))});
+  EXPECT_TRUE(wait.is_valid());
+}
+
+TEST(WaitForTest, AllOfEmpty) {
+  auto wait = WaitFor::all_of({});
+  EXPECT_TRUE(wait.is_valid());
+}
+
+TEST(WaitForTest, AnyOfNested) {
+  auto wait = WaitFor::any_of(
+      {WaitFor::message_on_stderr("Fatal"),
+       WaitFor::all_of({WaitFor::message_on_stdout("Ready"), WaitFor::millis(100)})});
+  EXPECT_TRUE(wait.is_valid());
+}
+
+TEST(WaitForTest, AnyOfEmptyThrows) { EXPECT_THROW(WaitFor::any_of({}), Error); }
+
+TEST(WaitForTest, AllOfWithTlsHttpThrows) {
+  EXPECT_THROW(WaitFor::all_of({WaitFor::http(HttpWaitStrategy::path("/").with_tls())}), Error);
+}
+
+TEST(WaitForTest, HealthWaitStrategyWithEvents) {
+  auto wait = WaitFor::Healthcheck(HealthWaitStrategy::healthcheck().with_events());
+  EXPECT_TRUE(wait.is_valid());
+}
+
+TEST(WaitForTest, ExitWaitStrategyWithEvents) {
+  auto wait = WaitFor::Exit(ExitWaitStrategy::exit().with_exit_code(0).with_events());
+  EXPECT_TRUE(wait.is_valid());
+}
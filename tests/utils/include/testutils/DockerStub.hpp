@@ -0,0 +1,93 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace testcontainers {
+namespace test_utils {
+
+/**
+ * @brief In-process fake of the Docker Engine API, listening on a Unix socket.
+ *
+ * Serves the endpoints GenericImage::start() and Container use: containers create, start,
+ * inspect, logs, exec, stop and remove, plus image inspect/pull, ping, version and events.
+ * Nothing is run: containers are records whose output comes from the on_start and on_exec
+ * handlers, and every image is reported present. Each endpoint can be given a fixed latency,
+ * so client-side overhead and concurrency can be measured without a daemon or registry.
+ *
+ * Point the library at it with DOCKER_HOST before its first Docker call; the connection is
+ * made once per process.
+ *
+ * Example:
+ * @code
+ * DockerStub stub;
+ * stub.set_latencies({.create = std::chrono::milliseconds(20)});
+ * setenv("DOCKER_HOST", stub.docker_host().c_str(), 1);
+ *
+ * auto container = GenericImage("alpine", "latest").start(); // ~20ms, no daemon involved
+ * @endcode
+ *
+ * Only available on POSIX systems.
+ */
+class DockerStub {
+public:
+  /// Delay added before answering each kind of request.
+  struct Latencies {
+    std::chrono::milliseconds create{0};
+    std::chrono::milliseconds start{0};
+    std::chrono::milliseconds inspect{0};
+    std::chrono::milliseconds logs{0};
+    std::chrono::milliseconds exec{0};
+    std::chrono::milliseconds stop{0};
+    std::chrono::milliseconds remove{0};
+  };
+
+  /// What a container or exec prints.
+  struct Output {
+    std::string out;
+    std::string err;
+    /// For containers, exit right after printing with this code; for execs, 0 when unset.
+    std::optional<std::int64_t> exit_code;
+  };
+
+  /// Called with the container or exec command, from the connection thread.
+  using Handler = std::function<Output(const std::vector<std::string> &cmd)>;
+
+  /// Listens on socket_path, a fresh path in the temp directory when empty.
+  explicit DockerStub(std::filesystem::path socket_path = {});
+  ~DockerStub();
+
+  DockerStub(const DockerStub &) = delete;
+  DockerStub &operator=(const DockerStub &) = delete;
+
+  /// unix:// URL of the socket, the value for DOCKER_HOST.
+  std::string docker_host() const;
+  const std::filesystem::path &socket_path() const;
+
+  void set_latencies(Latencies latencies);
+  /// Containers print nothing and keep running by default.
+  void set_on_start(Handler handler);
+  /// Execs print nothing and exit 0 by default.
+  void set_on_exec(Handler handler);
+
+  /// Requests served so far for one endpoint: "create", "start", "inspect", "logs", "exec",
+  /// "stop" or "remove".
+  std::size_t request_count(std::string_view endpoint) const;
+  /// Containers created and not removed yet.
+  std::size_t container_count() const;
+
+private:
+  struct State;
+  std::unique_ptr<State> state_;
+};
+
+} // namespace test_utils
+} // namespace testcontainers
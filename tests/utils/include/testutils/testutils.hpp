@@ -7,8 +7,13 @@
  * Include this header to get access to all testcontainers test utilities:
  * - TempFile: RAII temporary file management
  * - DockerCli: Docker CLI helper functions
+ * - DockerStub: In-process Docker Engine API stub (POSIX only)
  */
 
 #include "testutils/TempFile.hpp"
 #include "testutils/DockerCli.hpp"
 
+#ifndef _WIN32
+#include "testutils/DockerStub.hpp"
+#endif
+
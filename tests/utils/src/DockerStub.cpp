@@ -0,0 +1,1241 @@
+#include "testutils/DockerStub.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace testcontainers {
+namespace test_utils {
+
+namespace {
+
+// Docker reports unset timestamps as the zero time
+constexpr const char *ZERO_TIME = "0001-01-01T00:00:00Z";
+constexpr std::size_t MAX_HEADER_SIZE = 1024 * 1024;
+constexpr std::uint8_t STDOUT_STREAM = 1;
+constexpr std::uint8_t STDERR_STREAM = 2;
+
+// ---------- JSON ----------
+
+/// Just enough JSON to read request bodies.
+struct JsonValue {
+  enum class Kind { Null, Bool, Number, String, Array, Object };
+
+  Kind kind = Kind::Null;
+  bool boolean = false;
+  double number = 0;
+  std::string string;
+  std::vector<JsonValue> items;
+  std::vector<std::string> keys; // Object member names, values are in items
+
+  const JsonValue *find(std::string_view key) const {
+    if (kind != Kind::Object) {
+      return nullptr;
+    }
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      if (keys[i] == key) {
+        return &items[i];
+      }
+    }
+    return nullptr;
+  }
+
+  /// The string items of an array, empty for anything else.
+  std::vector<std::string> strings() const {
+    std::vector<std::string> result;
+    if (kind == Kind::Array) {
+      for (const auto &item : items) {
+        if (item.kind == Kind::String) {
+          result.push_back(item.string);
+        }
+      }
+    }
+    return result;
+  }
+};
+
+class JsonParser {
+public:
+  explicit JsonParser(std::string_view text) : text_(text) {}
+
+  /// Returns a Null value for malformed input, request bodies are trusted.
+  JsonValue parse() {
+    try {
+      return value();
+    } catch (const std::runtime_error &) {
+      return {};
+    }
+  }
+
+private:
+  JsonValue value() {
+    skip_space();
+    JsonValue result;
+    switch (peek()) {
+    case '{':
+      result.kind = JsonValue::Kind::Object;
+      ++pos_;
+      if (consume('}')) {
+        return result;
+      }
+      do {
+        skip_space();
+        result.keys.push_back(string());
+        skip_space();
+        expect(':');
+        result.items.push_back(value());
+        skip_space();
+      } while (consume(','));
+      expect('}');
+      return result;
+    case '[':
+      result.kind = JsonValue::Kind::Array;
+      ++pos_;
+      skip_space();
+      if (consume(']')) {
+        return result;
+      }
+      do {
+        result.items.push_back(value());
+        skip_space();
+      } while (consume(','));
+      expect(']');
+      return result;
+    case '"':
+      result.kind = JsonValue::Kind::String;
+      result.string = string();
+      return result;
+    case 't':
+    case 'f':
+      result.kind = JsonValue::Kind::Bool;
+      result.boolean = text_.substr(pos_, 4) == "true";
+      pos_ += result.boolean ? 4 : 5;
+      return result;
+    case 'n':
+      pos_ += 4;
+      return result;
+    default: {
+      auto end = text_.find_first_not_of("+-0123456789.eE", pos_);
+      end = end == std::string_view::npos ? text_.size() : end;
+      if (end == pos_) {
+        throw std::runtime_error("unexpected character");
+      }
+      result.kind = JsonValue::Kind::Number;
+      result.number = std::stod(std::string(text_.substr(pos_, end - pos_)));
+      pos_ = end;
+      return result;
+    }
+    }
+  }
+
+  std::string string() {
+    expect('"');
+    std::string result;
+    while (peek() != '"') {
+      char c = text_[pos_++];
+      if (c != '\\') {
+        result += c;
+        continue;
+      }
+      char escaped = peek();
+      ++pos_;
+      switch (escaped) {
+      case 'n':
+        result += '\n';
+        break;
+      case 't':
+        result += '\t';
+        break;
+      case 'r':
+        result += '\r';
+        break;
+      case 'b':
+        result += '\b';
+        break;
+      case 'f':
+        result += '\f';
+        break;
+      case 'u':
+        append_utf8(result, static_cast<std::uint32_t>(
+                                std::stoul(std::string(text_.substr(pos_, 4)), nullptr, 16)));
+        pos_ += 4;
+        break;
+      default:
+        result += escaped;
+      }
+    }
+    ++pos_;
+    return result;
+  }
+
+  // Surrogate pairs are kept as two code points, no request body the stub reads has them
+  static void append_utf8(std::string &out, std::uint32_t code) {
+    if (code < 0x80) {
+      out += static_cast<char>(code);
+    } else if (code < 0x800) {
+      out += static_cast<char>(0xC0 | (code >> 6));
+      out += static_cast<char>(0x80 | (code & 0x3F));
+    } else {
+      out += static_cast<char>(0xE0 | (code >> 12));
+      out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+      out += static_cast<char>(0x80 | (code & 0x3F));
+    }
+  }
+
+  char peek() const {
+    if (pos_ >= text_.size()) {
+      throw std::runtime_error("unexpected end");
+    }
+    return text_[pos_];
+  }
+
+  bool consume(char c) {
+    if (pos_ < text_.size() && text_[pos_] == c) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  void expect(char c) {
+    if (!consume(c)) {
+      throw std::runtime_error("unexpected character");
+    }
+  }
+
+  void skip_space() {
+    while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+      ++pos_;
+    }
+  }
+
+  std::string_view text_;
+  std::size_t pos_ = 0;
+};
+
+std::string quote(std::string_view text) {
+  std::string result = "\"";
+  for (char c : text) {
+    switch (c) {
+    case '"':
+      result += "\\\"";
+      break;
+    case '\\':
+      result += "\\\\";
+      break;
+    case '\n':
+      result += "\\n";
+      break;
+    case '\r':
+      result += "\\r";
+      break;
+    case '\t':
+      result += "\\t";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20) {
+        char escaped[8];
+        std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+        result += escaped;
+      } else {
+        result += c;
+      }
+    }
+  }
+  return result + "\"";
+}
+
+std::string quote_all(const std::vector<std::string> &items) {
+  std::string result = "[";
+  for (std::size_t i = 0; i < items.size(); ++i) {
+    result += (i > 0 ? "," : "") + quote(items[i]);
+  }
+  return result + "]";
+}
+
+// ---------- HTTP ----------
+
+struct Request {
+  std::string method;
+  /// Without the /v1.xx API version prefix and the query.
+  std::string path;
+  std::map<std::string, std::string> query;
+  /// Names in lower case.
+  std::map<std::string, std::string> headers;
+  std::string body;
+
+  bool flag(const std::string &name) const {
+    auto it = query.find(name);
+    return it != query.end() && (it->second == "1" || it->second == "true");
+  }
+
+  std::string header(const std::string &name) const {
+    auto it = headers.find(name);
+    return it == headers.end() ? std::string() : it->second;
+  }
+};
+
+std::string url_decode(std::string_view text) {
+  std::string result;
+  for (std::size_t i = 0; i < text.size(); ++i) {
+    if (text[i] == '%' && i + 2 < text.size()) {
+      result += static_cast<char>(std::stoi(std::string(text.substr(i + 1, 2)), nullptr, 16));
+      i += 2;
+    } else if (text[i] == '+') {
+      result += ' ';
+    } else {
+      result += text[i];
+    }
+  }
+  return result;
+}
+
+std::string lower(std::string text) {
+  std::transform(text.begin(), text.end(), text.begin(),
+                 [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+  return text;
+}
+
+std::string_view reason(int status) {
+  switch (status) {
+  case 101:
+    return "UPGRADED";
+  case 200:
+    return "OK";
+  case 201:
+    return "Created";
+  case 204:
+    return "No Content";
+  case 304:
+    return "Not Modified";
+  case 400:
+    return "Bad Request";
+  case 404:
+    return "Not Found";
+  case 409:
+    return "Conflict";
+  default:
+    return "Internal Server Error";
+  }
+}
+
+/// Frame of Docker's multiplexed stdout/stderr stream.
+std::string frame(std::uint8_t stream, std::string_view data) {
+  auto size = static_cast<std::uint32_t>(data.size());
+  std::string result = {static_cast<char>(stream),
+                        0,
+                        0,
+                        0,
+                        static_cast<char>(size >> 24),
+                        static_cast<char>(size >> 16),
+                        static_cast<char>(size >> 8),
+                        static_cast<char>(size)};
+  return result.append(data);
+}
+
+/// One accepted connection, closed after a single request.
+class Connection {
+public:
+  explicit Connection(int fd) : fd_(fd) {}
+
+  std::optional<Request> read_request() {
+    std::size_t header_end;
+    while ((header_end = buffer_.find("\r\n\r\n")) == std::string::npos) {
+      if (buffer_.size() > MAX_HEADER_SIZE || !read_more()) {
+        return std::nullopt;
+      }
+    }
+
+    Request request;
+    std::string_view head(buffer_.data(), header_end);
+    auto line_end = head.find("\r\n");
+    std::string_view request_line = head.substr(0, line_end);
+    auto method_end = request_line.find(' ');
+    auto target_end = request_line.find(' ', method_end + 1);
+    if (method_end == std::string_view::npos || target_end == std::string_view::npos) {
+      return std::nullopt;
+    }
+    request.method = std::string(request_line.substr(0, method_end));
+    parse_target(request, request_line.substr(method_end + 1, target_end - method_end - 1));
+
+    while (line_end != std::string_view::npos) {
+      auto start = line_end + 2;
+      line_end = head.find("\r\n", start);
+      auto line = head.substr(start, line_end == std::string_view::npos ? head.npos
+                                                                        : line_end - start);
+      auto colon = line.find(':');
+      if (colon == std::string_view::npos) {
+        continue;
+      }
+      auto value = line.substr(colon + 1);
+      value.remove_prefix(std::min(value.find_first_not_of(' '), value.size()));
+      request.headers[lower(std::string(line.substr(0, colon)))] = std::string(value);
+    }
+    buffer_.erase(0, header_end + 4);
+
+    if (lower(request.header("transfer-encoding")) == "chunked") {
+      if (!read_chunked(request.body)) {
+        return std::nullopt;
+      }
+    } else if (auto length = request.header("content-length"); !length.empty()) {
+      auto size = static_cast<std::size_t>(std::stoull(length));
+      while (buffer_.size() < size) {
+        if (!read_more()) {
+          return std::nullopt;
+        }
+      }
+      request.body = buffer_.substr(0, size);
+    }
+    return request;
+  }
+
+  bool send(std::string_view data) {
+    while (!data.empty()) {
+#ifdef MSG_NOSIGNAL
+      auto sent = ::send(fd_, data.data(), data.size(), MSG_NOSIGNAL);
+#else
+      auto sent = ::send(fd_, data.data(), data.size(), 0);
+#endif
+      if (sent < 0 && errno == EINTR) {
+        continue;
+      }
+      if (sent <= 0) {
+        return false;
+      }
+      data.remove_prefix(static_cast<std::size_t>(sent));
+    }
+    return true;
+  }
+
+  /// Head of a response whose body runs until the connection closes.
+  bool send_stream_head(int status, std::string_view content_type,
+                        std::string_view extra_headers = {}) {
+    return send("HTTP/1.1 " + std::to_string(status) + " " + std::string(reason(status)) +
+                "\r\nContent-Type: " + std::string(content_type) + "\r\n" +
+                std::string(extra_headers) + "Connection: close\r\n\r\n");
+  }
+
+  void respond(int status, std::string_view body = {},
+               std::string_view content_type = "application/json") {
+    std::string head = "HTTP/1.1 " + std::to_string(status) + " " + std::string(reason(status)) +
+                       "\r\n";
+    if (status != 204 && status != 304) {
+      head += "Content-Type: " + std::string(content_type) + "\r\n";
+      head += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+    }
+    send(head + "Connection: close\r\n\r\n" + std::string(body));
+  }
+
+  void respond_error(int status, std::string_view message) {
+    respond(status, "{\"message\":" + quote(message) + "}");
+  }
+
+private:
+  bool read_more() {
+    char chunk[16 * 1024];
+    ssize_t received;
+    do {
+      received = ::recv(fd_, chunk, sizeof(chunk), 0);
+    } while (received < 0 && errno == EINTR);
+    if (received <= 0) {
+      return false;
+    }
+    buffer_.append(chunk, static_cast<std::size_t>(received));
+    return true;
+  }
+
+  bool read_line(std::string &line) {
+    std::size_t end;
+    while ((end = buffer_.find("\r\n")) == std::string::npos) {
+      if (!read_more()) {
+        return false;
+      }
+    }
+    line = buffer_.substr(0, end);
+    buffer_.erase(0, end + 2);
+    return true;
+  }
+
+  bool read_chunked(std::string &body) {
+    std::string line;
+    while (read_line(line)) {
+      auto size = static_cast<std::size_t>(std::stoull(line, nullptr, 16));
+      if (size == 0) {
+        // Trailers up to the closing empty line
+        while (read_line(line) && !line.empty()) {
+        }
+        return true;
+      }
+      while (buffer_.size() < size + 2) {
+        if (!read_more()) {
+          return false;
+        }
+      }
+      body.append(buffer_, 0, size);
+      buffer_.erase(0, size + 2);
+    }
+    return false;
+  }
+
+  static void parse_target(Request &request, std::string_view target) {
+    auto query_start = target.find('?');
+    std::string_view path = target.substr(0, query_start);
+    if (path.size() > 2 && path[1] == 'v' && std::isdigit(static_cast<unsigned char>(path[2]))) {
+      auto next = path.find('/', 1);
+      path = next == std::string_view::npos ? std::string_view("/") : path.substr(next);
+    }
+    request.path = url_decode(path);
+
+    if (query_start == std::string_view::npos) {
+      return;
+    }
+    std::string_view query = target.substr(query_start + 1);
+    while (!query.empty()) {
+      auto amp = query.find('&');
+      auto pair = query.substr(0, amp);
+      auto eq = pair.find('=');
+      request.query[url_decode(pair.substr(0, eq))] =
+          eq == std::string_view::npos ? std::string() : url_decode(pair.substr(eq + 1));
+      query = amp == std::string_view::npos ? std::string_view() : query.substr(amp + 1);
+    }
+  }
+
+  int fd_;
+  std::string buffer_;
+};
+
+// ---------- Helpers ----------
+
+std::string timestamp_now() {
+  auto now = std::chrono::system_clock::now().time_since_epoch();
+  auto seconds = std::chrono::duration_cast<std::chrono::seconds>(now);
+  auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(now - seconds).count();
+  std::time_t time = seconds.count();
+  std::tm utc{};
+  gmtime_r(&time, &utc);
+  char buffer[48];
+  auto written = std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", &utc);
+  std::snprintf(buffer + written, sizeof(buffer) - written, ".%09lldZ",
+                static_cast<long long>(nanos));
+  return buffer;
+}
+
+std::string random_id() {
+  static std::mutex mutex;
+  static std::mt19937_64 engine{std::random_device{}()};
+  std::lock_guard lock(mutex);
+  std::string id;
+  for (int i = 0; i < 4; ++i) {
+    char part[17];
+    std::snprintf(part, sizeof(part), "%016llx", static_cast<unsigned long long>(engine()));
+    id += part;
+  }
+  return id;
+}
+
+std::filesystem::path default_socket_path() {
+  static std::atomic<int> counter{0};
+  // sockaddr_un paths are limited to ~100 bytes, so the name stays short
+  return std::filesystem::temp_directory_path() /
+         ("tc-docker-stub-" + std::to_string(::getpid()) + "-" + std::to_string(counter++) +
+          ".sock");
+}
+
+} // anonymous namespace
+
+// ---------- State ----------
+
+struct DockerStub::State {
+  struct LogChunk {
+    std::uint8_t stream;
+    std::string data;
+  };
+
+  struct Container {
+    enum class Status { Created, Running, Exited };
+
+    std::string id;
+    std::string name;
+    std::string image;
+    std::vector<std::string> cmd;
+    std::vector<std::string> env;
+    std::vector<std::pair<std::string, std::string>> labels;
+    std::vector<std::string> exposed_ports;
+    std::uint16_t first_host_port = 0;
+    std::string ip_address;
+    Status status = Status::Created;
+    std::int64_t exit_code = 0;
+    std::string created_at;
+    std::string started_at = ZERO_TIME;
+    std::string finished_at = ZERO_TIME;
+    std::vector<LogChunk> logs;
+  };
+
+  struct Exec {
+    std::string container_id;
+    std::vector<std::string> cmd;
+    std::optional<std::int64_t> exit_code;
+  };
+
+  std::filesystem::path socket_path;
+  int listen_fd = -1;
+  std::thread acceptor;
+
+  mutable std::mutex mutex;
+  /// Signalled on container, log and event changes, on connection exit and on shutdown.
+  std::condition_variable changed;
+  bool stopping = false;
+  std::size_t active_connections = 0;
+  std::set<int> open_fds;
+
+  Latencies latencies;
+  Handler on_start;
+  Handler on_exec;
+  std::map<std::string, std::size_t, std::less<>> counts;
+
+  std::map<std::string, Container> containers;
+  std::map<std::string, Exec> execs;
+  std::vector<std::string> events;
+  std::uint16_t next_host_port = 32768;
+  std::uint32_t next_address = 2;
+
+  void accept_loop() {
+    while (true) {
+      int fd = ::accept(listen_fd, nullptr, nullptr);
+      if (fd < 0 && errno == EINTR) {
+        continue;
+      }
+      std::lock_guard lock(mutex);
+      if (fd < 0 || stopping) {
+        if (fd >= 0) {
+          ::close(fd);
+        }
+        return;
+      }
+      ++active_connections;
+      open_fds.insert(fd);
+      std::thread([this, fd] { serve(fd); }).detach();
+    }
+  }
+
+  void serve(int fd) {
+    {
+      Connection connection(fd);
+      if (auto request = connection.read_request()) {
+        try {
+          route(connection, *request);
+        } catch (const std::exception &e) {
+          connection.respond_error(500, e.what());
+        }
+      }
+    }
+    std::lock_guard lock(mutex);
+    open_fds.erase(fd);
+    ::close(fd);
+    --active_connections;
+    changed.notify_all();
+  }
+
+  /// Counts the request and sleeps for the configured latency of the endpoint.
+  void enter(std::string_view endpoint, std::chrono::milliseconds Latencies::*latency) {
+    std::chrono::milliseconds delay;
+    {
+      std::lock_guard lock(mutex);
+      auto it = counts.find(endpoint);
+      if (it == counts.end()) {
+        it = counts.emplace(std::string(endpoint), 0).first;
+      }
+      ++it->second;
+      delay = latencies.*latency;
+    }
+    if (delay.count() > 0) {
+      std::this_thread::sleep_for(delay);
+    }
+  }
+
+  /// Looks a container up by id, unique id prefix or name. Must be called with mutex held.
+  Container *find(const std::string &key) {
+    if (auto it = containers.find(key); it != containers.end()) {
+      return &it->second;
+    }
+    Container *match = nullptr;
+    for (auto &[id, container] : containers) {
+      if (container.name == key || (!key.empty() && id.rfind(key, 0) == 0)) {
+        if (match != nullptr) {
+          return nullptr;
+        }
+        match = &container;
+      }
+    }
+    return match;
+  }
+
+  /// Must be called with mutex held.
+  void emit(const Container &container, std::string_view action) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    events.push_back(
+        "{\"Type\":\"container\",\"Action\":" + quote(action) + ",\"Actor\":{\"ID\":" +
+        quote(container.id) + ",\"Attributes\":{\"name\":" + quote(container.name) +
+        ",\"image\":" + quote(container.image) + ",\"exitCode\":" +
+        quote(std::to_string(container.exit_code)) + "}},\"status\":" + quote(action) +
+        ",\"id\":" + quote(container.id) + ",\"from\":" + quote(container.image) +
+        ",\"scope\":\"local\",\"time\":" + std::to_string(nanos / 1000000000) +
+        ",\"timeNano\":" + std::to_string(nanos) + "}\n");
+  }
+
+  /// Must be called with mutex held.
+  void exit_container(Container &container, std::int64_t exit_code) {
+    container.status = Container::Status::Exited;
+    container.exit_code = exit_code;
+    container.finished_at = timestamp_now();
+    emit(container, "die");
+  }
+
+  // ---------- Routing ----------
+
+  void route(Connection &connection, const Request &request) {
+    const auto &method = request.method;
+    const auto &path = request.path;
+    std::vector<std::string> segments;
+    for (std::size_t start = 1; start <= path.size();) {
+      auto end = std::min(path.find('/', start), path.size());
+      segments.push_back(path.substr(start, end - start));
+      start = end + 1;
+    }
+    auto is = [&](std::string_view m, std::size_t size) {
+      return method == m && segments.size() == size;
+    };
+
+    if (is("GET", 1) && segments[0] == "_ping") {
+      return connection.respond(200, "OK", "text/plain");
+    }
+    if (is("GET", 1) && segments[0] == "version") {
+      return connection.respond(
+          200, R"({"Version":"stub","ApiVersion":"1.47","MinAPIVersion":"1.24","Os":"linux"})");
+    }
+    if (is("GET", 1) && segments[0] == "info") {
+      std::lock_guard lock(mutex);
+      return connection.respond(200, "{\"ID\":\"docker-stub\",\"Containers\":" +
+                                         std::to_string(containers.size()) +
+                                         ",\"ServerVersion\":\"stub\",\"OSType\":\"linux\"}");
+    }
+    if (is("GET", 1) && segments[0] == "events") {
+      return stream_events(connection);
+    }
+
+    if (!segments.empty() && segments[0] == "images") {
+      if (is("POST", 2) && segments[1] == "create") {
+        auto image = request.query.find("fromImage");
+        return connection.respond(
+            200, "{\"status\":" +
+                     quote("Pulling from " +
+                           (image == request.query.end() ? std::string() : image->second)) +
+                     "}\n{\"status\":\"Status: Image is up to date\"}\n");
+      }
+      // Image names contain slashes, the name is everything between /images/ and /json
+      if (method == "GET" && segments.size() >= 3 && segments.back() == "json") {
+        auto name = path.substr(8, path.size() - 8 - 5);
+        return connection.respond(200, "{\"Id\":\"sha256:" + random_id() +
+                                           "\",\"RepoTags\":[" + quote(name) +
+                                           "],\"Os\":\"linux\",\"Size\":0,\"Config\":{}}");
+      }
+    }
+
+    if (!segments.empty() && segments[0] == "containers") {
+      if (is("GET", 2) && segments[1] == "json") {
+        return connection.respond(200, "[]");
+      }
+      if (is("POST", 2) && segments[1] == "create") {
+        return create(connection, request);
+      }
+      if (is("DELETE", 2)) {
+        return remove(connection, segments[1], request.flag("force"));
+      }
+      if (segments.size() == 3) {
+        const auto &id = segments[1];
+        const auto &action = segments[2];
+        if (method == "GET" && action == "json") {
+          return inspect(connection, id);
+        }
+        if (method == "POST" && action == "start") {
+          return start(connection, id);
+        }
+        if (method == "POST" && (action == "stop" || action == "kill")) {
+          return stop(connection, id);
+        }
+        if (method == "GET" && action == "logs") {
+          return logs(connection, id, request);
+        }
+        if (method == "POST" && action == "exec") {
+          return create_exec(connection, id, request);
+        }
+      }
+    }
+
+    if (!segments.empty() && segments[0] == "exec" && segments.size() == 3) {
+      if (method == "POST" && segments[2] == "start") {
+        return start_exec(connection, segments[1], request);
+      }
+      if (method == "GET" && segments[2] == "json") {
+        return inspect_exec(connection, segments[1]);
+      }
+    }
+
+    connection.respond_error(404, "page not found");
+  }
+
+  // ---------- Containers ----------
+
+  void create(Connection &connection, const Request &request) {
+    enter("create", &Latencies::create);
+    auto body = JsonParser(request.body).parse();
+
+    Container container;
+    container.id = random_id();
+    container.created_at = timestamp_now();
+    if (const auto *image = body.find("Image")) {
+      container.image = image->string;
+    }
+    if (const auto *entrypoint = body.find("Entrypoint")) {
+      container.cmd = entrypoint->strings();
+    }
+    if (const auto *cmd = body.find("Cmd")) {
+      auto args = cmd->strings();
+      container.cmd.insert(container.cmd.end(), args.begin(), args.end());
+    }
+    if (const auto *env = body.find("Env")) {
+      container.env = env->strings();
+    }
+    if (const auto *labels = body.find("Labels"); labels != nullptr) {
+      for (std::size_t i = 0; i < labels->keys.size(); ++i) {
+        container.labels.emplace_back(labels->keys[i], labels->items[i].string);
+      }
+    }
+    if (const auto *ports = body.find("ExposedPorts"); ports != nullptr) {
+      container.exposed_ports = ports->keys;
+    }
+
+    std::lock_guard lock(mutex);
+    auto name = request.query.find("name");
+    container.name = name != request.query.end() && !name->second.empty()
+                         ? name->second
+                         : "stub_" + container.id.substr(0, 12);
+    for (const auto &[id, other] : containers) {
+      if (other.name == container.name) {
+        return connection.respond_error(
+            409, "Conflict. The container name \"/" + container.name + "\" is already in use");
+      }
+    }
+    container.first_host_port = next_host_port;
+    next_host_port = static_cast<std::uint16_t>(next_host_port + container.exposed_ports.size());
+    container.ip_address = "172.17." + std::to_string(next_address / 256) + "." +
+                           std::to_string(next_address % 256);
+    ++next_address;
+    emit(container, "create");
+
+    auto id = container.id;
+    containers.emplace(id, std::move(container));
+    connection.respond(201, "{\"Id\":" + quote(id) + ",\"Warnings\":[]}");
+  }
+
+  void start(Connection &connection, const std::string &key) {
+    enter("start", &Latencies::start);
+    std::vector<std::string> cmd;
+    Handler handler;
+    {
+      std::lock_guard lock(mutex);
+      auto *container = find(key);
+      if (container == nullptr) {
+        return connection.respond_error(404, "No such container: " + key);
+      }
+      if (container->status == Container::Status::Running) {
+        return connection.respond(304);
+      }
+      cmd = container->cmd;
+      handler = on_start;
+    }
+
+    auto output = handler ? handler(cmd) : Output{};
+
+    std::lock_guard lock(mutex);
+    auto *container = find(key);
+    if (container == nullptr) {
+      return connection.respond_error(404, "No such container: " + key);
+    }
+    container->status = Container::Status::Running;
+    container->started_at = timestamp_now();
+    container->finished_at = ZERO_TIME;
+    if (!output.out.empty()) {
+      container->logs.push_back({STDOUT_STREAM, std::move(output.out)});
+    }
+    if (!output.err.empty()) {
+      container->logs.push_back({STDERR_STREAM, std::move(output.err)});
+    }
+    emit(*container, "start");
+    if (output.exit_code) {
+      exit_container(*container, *output.exit_code);
+    }
+    changed.notify_all();
+    connection.respond(204);
+  }
+
+  void stop(Connection &connection, const std::string &key) {
+    enter("stop", &Latencies::stop);
+    std::lock_guard lock(mutex);
+    auto *container = find(key);
+    if (container == nullptr) {
+      return connection.respond_error(404, "No such container: " + key);
+    }
+    if (container->status != Container::Status::Running) {
+      return connection.respond(304);
+    }
+    // What a shell that ignores SIGTERM reports after the kill that follows
+    exit_container(*container, 137);
+    changed.notify_all();
+    connection.respond(204);
+  }
+
+  void remove(Connection &connection, const std::string &key, bool force) {
+    enter("remove", &Latencies::remove);
+    std::lock_guard lock(mutex);
+    auto *container = find(key);
+    if (container == nullptr) {
+      return connection.respond_error(404, "No such container: " + key);
+    }
+    if (container->status == Container::Status::Running) {
+      if (!force) {
+        return connection.respond_error(
+            409, "You cannot remove a running container " + container->id +
+                     ". Stop the container before attempting removal or force remove");
+      }
+      exit_container(*container, 137);
+    }
+    emit(*container, "destroy");
+    auto id = container->id;
+    std::erase_if(execs, [&](const auto &exec) { return exec.second.container_id == id; });
+    containers.erase(id);
+    changed.notify_all();
+    connection.respond(204);
+  }
+
+  void inspect(Connection &connection, const std::string &key) {
+    enter("inspect", &Latencies::inspect);
+    std::lock_guard lock(mutex);
+    const auto *container = find(key);
+    if (container == nullptr) {
+      return connection.respond_error(404, "No such container: " + key);
+    }
+
+    const char *status = "created";
+    if (container->status == Container::Status::Running) {
+      status = "running";
+    } else if (container->status == Container::Status::Exited) {
+      status = "exited";
+    }
+    bool running = container->status == Container::Status::Running;
+
+    std::string ports;
+    std::string exposed;
+    for (std::size_t i = 0; i < container->exposed_ports.size(); ++i) {
+      auto host_port = quote(std::to_string(container->first_host_port + i));
+      auto port = quote(container->exposed_ports[i]);
+      ports += (i > 0 ? "," : "") + port + ":[{\"HostIp\":\"0.0.0.0\",\"HostPort\":" +
+               host_port + "},{\"HostIp\":\"::\",\"HostPort\":" + host_port + "}]";
+      exposed += (i > 0 ? "," : "") + port + ":{}";
+    }
+    std::string labels;
+    for (std::size_t i = 0; i < container->labels.size(); ++i) {
+      labels += (i > 0 ? "," : "") + quote(container->labels[i].first) + ":" +
+                quote(container->labels[i].second);
+    }
+    auto ip = quote(running ? container->ip_address : "");
+
+    connection.respond(
+        200,
+        "{\"Id\":" + quote(container->id) + ",\"Created\":" + quote(container->created_at) +
+            ",\"Path\":" + quote(container->cmd.empty() ? "" : container->cmd.front()) +
+            ",\"Args\":" +
+            quote_all(container->cmd.empty()
+                          ? std::vector<std::string>()
+                          : std::vector<std::string>(container->cmd.begin() + 1,
+                                                     container->cmd.end())) +
+            ",\"State\":{\"Status\":" + quote(status) +
+            ",\"Running\":" + (running ? "true" : "false") +
+            ",\"Paused\":false,\"Restarting\":false,\"OOMKilled\":false,\"Dead\":false"
+            ",\"Pid\":" + (running ? "4242" : "0") +
+            ",\"ExitCode\":" + std::to_string(container->exit_code) +
+            ",\"Error\":\"\",\"StartedAt\":" + quote(container->started_at) +
+            ",\"FinishedAt\":" + quote(container->finished_at) +
+            "},\"Image\":\"sha256:stub\",\"Name\":" + quote("/" + container->name) +
+            ",\"RestartCount\":0,\"Driver\":\"stub\",\"Platform\":\"linux\""
+            ",\"Config\":{\"Image\":" + quote(container->image) +
+            ",\"Cmd\":" + quote_all(container->cmd) + ",\"Env\":" + quote_all(container->env) +
+            ",\"Labels\":{" + labels + "},\"ExposedPorts\":{" + exposed + "}}" +
+            ",\"HostConfig\":{\"NetworkMode\":\"bridge\",\"PublishAllPorts\":true}" +
+            ",\"NetworkSettings\":{\"Gateway\":\"172.17.0.1\",\"IPAddress\":" + ip +
+            ",\"Ports\":{" + ports + "},\"Networks\":{\"bridge\":{\"NetworkID\":\"stub\"" +
+            ",\"Gateway\":\"172.17.0.1\",\"IPAddress\":" + ip + "}}}}");
+  }
+
+  void logs(Connection &connection, const std::string &key, const Request &request) {
+    enter("logs", &Latencies::logs);
+    bool want_stdout = request.flag("stdout");
+    bool want_stderr = request.flag("stderr");
+    bool follow = request.flag("follow");
+
+    std::unique_lock lock(mutex);
+    const auto *container = find(key);
+    if (container == nullptr) {
+      return connection.respond_error(404, "No such container: " + key);
+    }
+    auto id = container->id;
+    lock.unlock();
+    if (!connection.send_stream_head(200, "application/vnd.docker.multiplexed-stream")) {
+      return;
+    }
+    lock.lock();
+
+    std::size_t sent = 0;
+    while (true) {
+      container = find(id);
+      if (container == nullptr) {
+        return;
+      }
+      std::string chunk;
+      for (; sent < container->logs.size(); ++sent) {
+        const auto &log = container->logs[sent];
+        if ((log.stream == STDOUT_STREAM && want_stdout) ||
+            (log.stream == STDERR_STREAM && want_stderr)) {
+          chunk += frame(log.stream, log.data);
+        }
+      }
+      auto status = container->status;
+      bool done = !follow || status == Container::Status::Exited || stopping;
+
+      lock.unlock();
+      if (!chunk.empty() && !connection.send(chunk)) {
+        return;
+      }
+      lock.lock();
+      if (done) {
+        return;
+      }
+      changed.wait(lock, [&] {
+        const auto *current = find(id);
+        return stopping || current == nullptr || current->logs.size() != sent ||
+               current->status != status;
+      });
+    }
+  }
+
+  // ---------- Exec ----------
+
+  void create_exec(Connection &connection, const std::string &key, const Request &request) {
+    auto body = JsonParser(request.body).parse();
+    std::lock_guard lock(mutex);
+    const auto *container = find(key);
+    if (container == nullptr) {
+      return connection.respond_error(404, "No such container: " + key);
+    }
+    if (container->status != Container::Status::Running) {
+      return connection.respond_error(409, "Container " + container->id + " is not running");
+    }
+    auto id = random_id();
+    const auto *cmd = body.find("Cmd");
+    execs[id] = Exec{container->id, cmd != nullptr ? cmd->strings() : std::vector<std::string>{},
+                     std::nullopt};
+    connection.respond(201, "{\"Id\":" + quote(id) + "}");
+  }
+
+  void start_exec(Connection &connection, const std::string &id, const Request &request) {
+    enter("exec", &Latencies::exec);
+    std::vector<std::string> cmd;
+    Handler handler;
+    {
+      std::lock_guard lock(mutex);
+      auto exec = execs.find(id);
+      if (exec == execs.end()) {
+        return connection.respond_error(404, "No such exec instance: " + id);
+      }
+      cmd = exec->second.cmd;
+      handler = on_exec;
+    }
+
+    auto output = handler ? handler(cmd) : Output{};
+    {
+      std::lock_guard lock(mutex);
+      if (auto exec = execs.find(id); exec != execs.end()) {
+        exec->second.exit_code = output.exit_code.value_or(0);
+      }
+    }
+
+    // Docker hijacks the connection when the client asks for an upgrade, bollard always does
+    bool upgrade = !request.header("upgrade").empty();
+    bool head_sent =
+        upgrade ? connection.send_stream_head(101, "application/vnd.docker.raw-stream",
+                                              "Upgrade: tcp\r\n")
+                : connection.send_stream_head(200, "application/vnd.docker.raw-stream");
+    if (!head_sent) {
+      return;
+    }
+    std::string stream;
+    if (!output.out.empty()) {
+      stream += frame(STDOUT_STREAM, output.out);
+    }
+    if (!output.err.empty()) {
+      stream += frame(STDERR_STREAM, output.err);
+    }
+    connection.send(stream);
+  }
+
+  void inspect_exec(Connection &connection, const std::string &id) {
+    std::lock_guard lock(mutex);
+    auto exec = execs.find(id);
+    if (exec == execs.end()) {
+      return connection.respond_error(404, "No such exec instance: " + id);
+    }
+    const auto &cmd = exec->second.cmd;
+    auto exit_code = exec->second.exit_code;
+    connection.respond(
+        200, "{\"ID\":" + quote(id) + ",\"ContainerID\":" + quote(exec->second.container_id) +
+                 ",\"Running\":false,\"ExitCode\":" +
+                 (exit_code ? std::to_string(*exit_code) : "null") +
+                 ",\"ProcessConfig\":{\"entrypoint\":" + quote(cmd.empty() ? "" : cmd.front()) +
+                 ",\"arguments\":" +
+                 quote_all(cmd.empty() ? std::vector<std::string>()
+                                       : std::vector<std::string>(cmd.begin() + 1, cmd.end())) +
+                 "},\"Pid\":0}");
+  }
+
+  // ---------- Events ----------
+
+  /// Streams every container event from now on, filters are ignored.
+  void stream_events(Connection &connection) {
+    if (!connection.send_stream_head(200, "application/json")) {
+      return;
+    }
+    std::unique_lock lock(mutex);
+    auto sent = events.size();
+    while (!stopping) {
+      changed.wait(lock, [&] { return stopping || events.size() != sent; });
+      std::string chunk;
+      for (; sent < events.size(); ++sent) {
+        chunk += events[sent];
+      }
+      lock.unlock();
+      if (!chunk.empty() && !connection.send(chunk)) {
+        return;
+      }
+      lock.lock();
+    }
+  }
+};
+
+// ---------- DockerStub ----------
+
+DockerStub::DockerStub(std::filesystem::path socket_path) : state_(std::make_unique<State>()) {
+  state_->socket_path = socket_path.empty() ? default_socket_path() : std::move(socket_path);
+
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  auto path = state_->socket_path.string();
+  if (path.size() >= sizeof(address.sun_path)) {
+    throw std::runtime_error("Docker stub socket path is too long: " + path);
+  }
+  std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+  std::error_code ignored;
+  std::filesystem::remove(state_->socket_path, ignored);
+  state_->listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (state_->listen_fd < 0 ||
+      ::bind(state_->listen_fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+      ::listen(state_->listen_fd, 128) != 0) {
+    auto error = std::system_error(errno, std::generic_category(),
+                                   "Failed to listen on Docker stub socket " + path);
+    if (state_->listen_fd >= 0) {
+      ::close(state_->listen_fd);
+    }
+    throw error;
+  }
+  state_->acceptor = std::thread([state = state_.get()] { state->accept_loop(); });
+}
+
+DockerStub::~DockerStub() {
+  {
+    std::lock_guard lock(state_->mutex);
+    state_->stopping = true;
+    for (int fd : state_->open_fds) {
+      ::shutdown(fd, SHUT_RDWR);
+    }
+  }
+  state_->changed.notify_all();
+
+  // accept() is not interrupted by closing the socket everywhere, a connection always wakes it
+  sockaddr_un address{};
+  address.sun_family = AF_UNIX;
+  auto path = state_->socket_path.string();
+  std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+  int wake = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (wake >= 0) {
+    ::connect(wake, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+    ::close(wake);
+  }
+  state_->acceptor.join();
+  ::close(state_->listen_fd);
+
+  {
+    std::unique_lock lock(state_->mutex);
+    state_->changed.wait(lock, [this] { return state_->active_connections == 0; });
+  }
+  std::error_code ignored;
+  std::filesystem::remove(state_->socket_path, ignored);
+}
+
+std::string DockerStub::docker_host() const { return "unix://" + state_->socket_path.string(); }
+
+const std::filesystem::path &DockerStub::socket_path() const { return state_->socket_path; }
+
+void DockerStub::set_latencies(Latencies latencies) {
+  std::lock_guard lock(state_->mutex);
+  state_->latencies = latencies;
+}
+
+void DockerStub::set_on_start(Handler handler) {
+  std::lock_guard lock(state_->mutex);
+  state_->on_start = std::move(handler);
+}
+
+void DockerStub::set_on_exec(Handler handler) {
+  std::lock_guard lock(state_->mutex);
+  state_->on_exec = std::move(handler);
+}
+
+std::size_t DockerStub::request_count(std::string_view endpoint) const {
+  std::lock_guard lock(state_->mutex);
+  auto it = state_->counts.find(endpoint);
+  return it == state_->counts.end() ? 0 : it->second;
+}
+
+std::size_t DockerStub::container_count() const {
+  std::lock_guard lock(state_->mutex);
+  return state_->containers.size();
+}
+
+} // namespace test_utils
+} // namespace testcontainers